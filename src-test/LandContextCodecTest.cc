@@ -0,0 +1,188 @@
+#include "TestRunner.h"
+
+#include "pland/land/repo/LandContext.h"
+#include "pland/land/repo/internal/BinaryStream.h"
+#include "pland/land/repo/internal/LandContextCodec.h"
+
+#include "mc/platform/UUID.h"
+
+#include "fmt/core.h"
+
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace land::test {
+
+namespace {
+
+using internal::BinaryReader;
+using internal::BinaryWriter;
+using internal::LandContextCodec;
+
+constexpr auto OwnerUuid  = "00112233-4455-6677-8899-aabbccddeeff";
+constexpr auto MemberUuid = "fedcba98-7654-3210-0123-456789abcdef";
+constexpr auto MemberXuid = "2535412345678901"; // 无法转换为 UUID 的成员，按原始字符串保存
+
+LandContext makeContext() {
+    LandContext context;
+    context.mPos.min                                      = {-1024, -64, -300000};
+    context.mPos.max                                      = {77, 319, 12};
+    context.mTeleportPos                                  = {5, 70, -8};
+    context.mLandID                                       = 123456;
+    context.mLandDimid                                    = 2;
+    context.mIs3DLand                                     = true;
+    context.mLandPermTable.environment.allowFireSpread    = false;
+    context.mLandPermTable.environment.allowLightningBolt = false;
+    context.mLandPermTable.role.allowDestroy              = {false, true};
+    context.mLandPermTable.role.useBed                    = {false, true};
+    context.mLandOwner                                    = OwnerUuid;
+    context.mLandMembers                                  = {MemberUuid, MemberXuid};
+    context.mLandName                                     = "测试领地 §a#1";
+    context.mOriginalBuyPrice                             = 4096;
+    context.mParentLandID                                 = 42;
+    context.mSubLandIDs                                   = {7, 8, 900000};
+    return context;
+}
+
+bool samePerms(LandPermTable const& lhs, LandPermTable const& rhs) {
+    return std::memcmp(&lhs.environment, &rhs.environment, sizeof(EnvironmentPerms)) == 0
+        && std::memcmp(&lhs.role, &rhs.role, sizeof(RolePerms)) == 0;
+}
+
+void expectSame(LandContext const& lhs, LandContext const& rhs) {
+    LD_EXPECT(lhs.mPos.min == rhs.mPos.min && lhs.mPos.max == rhs.mPos.max);
+    LD_EXPECT(lhs.mTeleportPos == rhs.mTeleportPos);
+    LD_EXPECT(lhs.mLandID == rhs.mLandID);
+    LD_EXPECT(lhs.mLandDimid == rhs.mLandDimid);
+    LD_EXPECT(lhs.mIs3DLand == rhs.mIs3DLand);
+    LD_EXPECT(samePerms(lhs.mLandPermTable, rhs.mLandPermTable));
+    LD_EXPECT(lhs.mLandOwner == rhs.mLandOwner);
+    LD_EXPECT(lhs.mLandMembers == rhs.mLandMembers);
+    LD_EXPECT(lhs.mLandName == rhs.mLandName);
+    LD_EXPECT(lhs.mOriginalBuyPrice == rhs.mOriginalBuyPrice);
+    LD_EXPECT(lhs.mParentLandID == rhs.mParentLandID);
+    LD_EXPECT(lhs.mSubLandIDs == rhs.mSubLandIDs);
+}
+
+/**
+ * @brief 替换数据头中的格式版本与结构版本，字段部分保持不变
+ */
+std::string rewriteHeader(std::string_view data, uint8_t format, int schema) {
+    BinaryReader reader{data};
+    uint8_t      magic{0};
+    uint8_t      version{0};
+    int64_t      oldSchema{0};
+    reader.read(magic);
+    reader.read(version);
+    reader.readZigzag(oldSchema);
+    LD_EXPECT(reader.ok());
+
+    std::string  result;
+    BinaryWriter writer{result};
+    writer.write(magic);
+    writer.write(format);
+    writer.writeZigzag(schema);
+    result.append(data.substr(data.size() - reader.remaining()));
+    return result;
+}
+
+} // namespace
+
+LD_TEST_CASE(LandContextCodec_RoundTrip) {
+    auto const context = makeContext();
+    auto const data    = LandContextCodec::encode(context);
+    LD_EXPECT(LandContextCodec::isBinary(data));
+    LD_EXPECT(LandContextCodec::peekSchema(data) == LandSchemaVersion);
+
+    LandContext decoded;
+    LD_EXPECT(LandContextCodec::decode(data, decoded));
+    expectSame(decoded, context);
+
+    // 截断的数据不得越界读取；缺少数据头(3 字节)或截断在字段内部时解码失败
+    for (size_t size = 0; size < data.size(); ++size) {
+        LandContext truncated;
+        bool const  ok = LandContextCodec::decode(std::string_view{data}.substr(0, size), truncated);
+        LD_EXPECT_MSG(!ok || size >= 3, fmt::format("size={}", size));
+    }
+    LandContext truncated;
+    LD_EXPECT(!LandContextCodec::decode(std::string_view{data}.substr(0, data.size() - 1), truncated));
+}
+
+LD_TEST_CASE(LandContextCodec_PartialMerge) {
+    auto const original = makeContext();
+    auto       modified = original;
+    modified.mLandPermTable.environment.allowExplode = true;
+    modified.mTeleportPos                            = {1, 2, 3};
+    modified.mLandName                               = "不应写入";
+
+    // 仅写入权限表分组，合并后其它字段保持原值
+    auto merged = original;
+    LD_EXPECT(LandContextCodec::decode(LandContextCodec::encode(modified, LandContextCodec::Perms), merged));
+    LD_EXPECT(samePerms(merged.mLandPermTable, modified.mLandPermTable));
+    LD_EXPECT(merged.mTeleportPos == original.mTeleportPos);
+    LD_EXPECT(merged.mLandName == original.mLandName);
+    LD_EXPECT(merged.mLandMembers == original.mLandMembers);
+}
+
+LD_TEST_CASE(LandContextCodec_UuidIsLittleEndian) {
+    auto const uuid = mce::UUID::fromString(OwnerUuid);
+
+    std::string expected;
+    for (auto half : {uuid.a, uuid.b}) {
+        for (int i = 0; i < 8; ++i) {
+            expected.push_back(static_cast<char>(half >> (i * 8)));
+        }
+    }
+    auto const data = LandContextCodec::encode(makeContext(), LandContextCodec::Identity);
+    LD_EXPECT(data.find(expected) != std::string::npos);
+
+    // 格式版本 1 的数据(小端平台写入)仍可读取
+    LandContext decoded;
+    LD_EXPECT(LandContextCodec::decode(rewriteHeader(data, 1, LandSchemaVersion), decoded));
+    LD_EXPECT(decoded.mLandOwner == OwnerUuid);
+    LD_EXPECT(
+        !LandContextCodec::decode(rewriteHeader(data, LandContextCodec::FormatVersion + 1, LandSchemaVersion), decoded)
+    );
+}
+
+LD_TEST_CASE(LandContextCodec_OldPermLayoutToJson) {
+    auto const context = makeContext();
+    auto const data =
+        rewriteHeader(LandContextCodec::encode(context), LandContextCodec::FormatVersion, LandSchemaVersion - 1);
+
+    // 旧结构版本的数据不能直接解码，须还原为 JSON 交由迁移器升级
+    LandContext decoded;
+    LD_EXPECT(!LandContextCodec::decode(data, decoded));
+    LD_EXPECT(LandContextCodec::peekSchema(data) == LandSchemaVersion - 1);
+
+    // 模拟旧版本中名称不同的权限：按写入时的位序还原为旧名称
+    auto       layout     = LandContextCodec::currentPermLayout();
+    auto const envName    = layout.environment.front();
+    auto const roleName   = layout.role.front();
+    layout.environment[0] = "legacyEnvironmentPerm";
+    layout.role[0]        = "legacyRolePerm";
+
+    auto json = LandContextCodec::decodeToJson(data, layout);
+    LD_EXPECT(json.has_value());
+    LD_EXPECT((*json)["version"] == LandSchemaVersion - 1);
+    LD_EXPECT((*json)["mLandID"] == context.mLandID);
+    LD_EXPECT((*json)["mLandOwner"] == context.mLandOwner);
+    LD_EXPECT((*json)["mLandMembers"] == context.mLandMembers);
+    LD_EXPECT((*json)["mSubLandIDs"] == context.mSubLandIDs);
+
+    auto const& environment = (*json)["mLandPermTable"]["environment"];
+    auto const& role        = (*json)["mLandPermTable"]["role"];
+    LD_EXPECT(!environment.contains(envName) && !role.contains(roleName));
+    LD_EXPECT(environment["legacyEnvironmentPerm"] == context.mLandPermTable.environment.allowFireSpread);
+    LD_EXPECT(role["legacyRolePerm"]["member"] == context.mLandPermTable.role.allowDestroy.member);
+    LD_EXPECT(role["legacyRolePerm"]["guest"] == context.mLandPermTable.role.allowDestroy.guest);
+    LD_EXPECT(environment["allowLightningBolt"] == context.mLandPermTable.environment.allowLightningBolt);
+    LD_EXPECT(role["useBed"]["guest"] == context.mLandPermTable.role.useBed.guest);
+
+    // 位数与写入时的位序不一致视为损坏
+    layout.environment.emplace_back("removedLater");
+    LD_EXPECT(!LandContextCodec::decodeToJson(data, layout).has_value());
+}
+
+} // namespace land::test
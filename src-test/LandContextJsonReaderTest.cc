@@ -0,0 +1,142 @@
+#include "TestRunner.h"
+
+#include "pland/land/repo/LandContext.h"
+#include "pland/land/repo/internal/LandContextCodec.h"
+#include "pland/land/repo/internal/LandContextJsonReader.h"
+#include "pland/utils/JsonUtil.h"
+
+#include "fmt/core.h"
+#include "nlohmann/json.hpp"
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace land::test {
+
+namespace {
+
+using internal::LandContextCodec;
+using internal::LandContextJsonReader;
+
+/**
+ * @brief 经反射(DOM)路径解析，作为流式解析的参照
+ */
+LandContext readByReflection(std::string const& text) {
+    auto        json = nlohmann::ordered_json::parse(text);
+    LandContext context;
+    json_util::json2struct(json, context);
+    return context;
+}
+
+LandContext randomContext(std::mt19937& rng, LandID id) {
+    auto randomIn   = [&](int lo, int hi) { return std::uniform_int_distribution{lo, hi}(rng); };
+    auto randomBool = [&] { return randomIn(0, 1) == 1; };
+
+    LandContext context;
+    context.mLandID      = id;
+    context.mLandDimid   = randomIn(0, 2);
+    context.mIs3DLand    = randomBool();
+    context.mPos.min     = {randomIn(-30000000, 0), randomIn(-64, 0), randomIn(-30000000, 0)};
+    context.mPos.max     = {randomIn(0, 30000000), randomIn(0, 319), randomIn(0, 30000000)};
+    context.mTeleportPos = {randomIn(-100, 100), randomIn(-64, 319), randomIn(-100, 100)};
+    context.mLandOwner   = fmt::format("{:08x}-4455-6677-8899-aabbccddeeff", randomIn(0, 1 << 30));
+    for (int i = randomIn(0, 4); i > 0; --i) {
+        context.mLandMembers.push_back(fmt::format("{:08x}-0000-0000-0000-000000000000", randomIn(0, 1 << 30)));
+    }
+    context.mLandName         = fmt::format("领地 \"{}\" \\ §a\t{}", id, randomIn(0, 999));
+    context.mOriginalBuyPrice = randomIn(-1, 1 << 30);
+    context.mParentLandID     = randomBool() ? randomIn(0, 1000) : INVALID_LAND_ID;
+    for (int i = randomIn(0, 5); i > 0; --i) {
+        context.mSubLandIDs.push_back(randomIn(0, 100000));
+    }
+
+    // 权限表逐位随机
+    auto        json   = json_util::struct2json(context);
+    auto const& layout = LandContextCodec::currentPermLayout();
+    for (auto const& name : layout.environment) {
+        json["mLandPermTable"]["environment"][name] = randomBool();
+    }
+    for (auto const& name : layout.role) {
+        json["mLandPermTable"]["role"][name] = {{"member", randomBool()}, {"guest", randomBool()}};
+    }
+    return readByReflection(json.dump());
+}
+
+} // namespace
+
+LD_TEST_CASE(LandContextJsonReader_MatchesReflection) {
+    std::mt19937 rng{24};
+    for (LandID id = 0; id < 100; ++id) {
+        auto const context = randomContext(rng, id);
+        auto const text    = json_util::struct2json(context).dump(id % 2 == 0 ? -1 : 4); // 紧凑与缩进格式
+
+        LandContext streamed;
+        LD_EXPECT_MSG(LandContextJsonReader::read(text, streamed), fmt::format("land {}", id));
+
+        // 以完整二进制编码比较全部字段
+        auto const expected = LandContextCodec::encode(readByReflection(text));
+        LD_EXPECT_MSG(LandContextCodec::encode(streamed) == expected, fmt::format("land {}", id));
+        LD_EXPECT_MSG(LandContextCodec::encode(context) == expected, fmt::format("land {}", id));
+    }
+}
+
+LD_TEST_CASE(LandContextJsonReader_FieldOrderAndUnknownKeys) {
+    std::mt19937 rng{42};
+    auto const   context = randomContext(rng, 7);
+    auto         json    = json_util::struct2json(context);
+
+    // 字段顺序颠倒，并插入未知字段(含嵌套对象与数组)
+    nlohmann::ordered_json reordered;
+    reordered["unknownObject"] = {{"a", {1, 2, {{"b", nullptr}}}}, {"c", "d"}};
+    for (auto iter = json.rbegin(); iter != json.rend(); ++iter) {
+        reordered[iter.key()] = iter.value();
+    }
+    reordered["mLandPermTable"]["environment"]["removedPerm"] = true;
+    reordered["unknownArray"]                                 = {1.5, "x", false};
+
+    LandContext streamed;
+    LD_EXPECT(LandContextJsonReader::read(reordered.dump(), streamed));
+    LD_EXPECT(LandContextCodec::encode(streamed) == LandContextCodec::encode(context));
+}
+
+LD_TEST_CASE(LandContextJsonReader_RejectsUnsupported) {
+    std::mt19937 rng{4};
+    auto const   json = json_util::struct2json(randomContext(rng, 1));
+
+    auto rejects = [](nlohmann::ordered_json const& value) {
+        LandContext context;
+        return !LandContextJsonReader::read(value.dump(), context);
+    };
+
+    // 旧结构版本须交由迁移器处理
+    auto old       = json;
+    old["version"] = LandSchemaVersion - 1;
+    LD_EXPECT(rejects(old));
+
+    auto noVersion = json;
+    noVersion.erase("version");
+    LD_EXPECT(rejects(noVersion));
+
+    auto noName = json;
+    noName.erase("mLandName");
+    LD_EXPECT(rejects(noName));
+
+    auto wrongType       = json;
+    wrongType["mLandID"] = "123";
+    LD_EXPECT(rejects(wrongType));
+
+    auto wrongPerm = json;
+    // 权限值必须为布尔值
+    wrongPerm["mLandPermTable"]["environment"]["allowExplode"] = 1;
+    LD_EXPECT(rejects(wrongPerm));
+
+    LandContext context;
+    auto const  text = json.dump();
+    LD_EXPECT(!LandContextJsonReader::read(std::string_view{text}.substr(0, text.size() / 2), context));
+    LD_EXPECT(!LandContextJsonReader::read("[]", context));
+    LD_EXPECT(!LandContextJsonReader::read("", context));
+}
+
+} // namespace land::test
@@ -0,0 +1,325 @@
+#include "LandTestAccess.h"
+#include "TestRunner.h"
+
+#include "pland/land/repo/internal/LandDimensionChunkMap.h"
+
+#include "fmt/core.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace land::test {
+
+namespace {
+
+using internal::LandDimensionChunkMap;
+using ChunkRect = LandDimensionChunkMap::ChunkRect;
+
+constexpr int MinY = -64;
+constexpr int MaxY = 319;
+
+int randomIn(std::mt19937& rng, int lo, int hi) { return std::uniform_int_distribution{lo, hi}(rng); }
+
+std::shared_ptr<Land> makeLand(LandID id, int x0, int z0, int x1, int z1, bool is3D = false, int y0 = MinY, int y1 = MaxY) {
+    LandAABB aabb;
+    aabb.min = {x0, y0, z0};
+    aabb.max = {x1, y1, z1};
+    return LandTestAccess::make(id, aabb, is3D);
+}
+
+std::shared_ptr<Land> randomLand(std::mt19937& rng, LandID id, int maxSize) {
+    int const  x0   = randomIn(rng, -3000, 3000);
+    int const  z0   = randomIn(rng, -3000, 3000);
+    bool const is3D = randomIn(rng, 0, 1) == 1;
+    int const  y0   = is3D ? randomIn(rng, MinY, 250) : MinY;
+    int const  y1   = is3D ? randomIn(rng, y0, std::min(MaxY, y0 + 60)) : MaxY;
+    return makeLand(id, x0, z0, x0 + randomIn(rng, 0, maxSize), z0 + randomIn(rng, 0, maxSize), is3D, y0, y1);
+}
+
+ChunkRect chunkRectOf(Land const& land) {
+    auto const& aabb = land.getAABB();
+    return {aabb.min.x >> 4, aabb.max.x >> 4, aabb.min.z >> 4, aabb.max.z >> 4};
+}
+
+/**
+ * @brief 以索引遍历区块矩形，校验每个领地仅上报一次
+ */
+std::vector<LandID> collect(LandDimensionChunkMap const& map, ChunkRect const& rect, int minSection, int maxSection) {
+    std::vector<LandID> ids;
+    map.forEachLandIn(0, rect.mMinX, rect.mMaxX, rect.mMinZ, rect.mMaxZ, minSection, maxSection, [&](LandID id) {
+        ids.push_back(id);
+        return true;
+    });
+    std::sort(ids.begin(), ids.end());
+    LD_EXPECT_MSG(std::adjacent_find(ids.begin(), ids.end()) == ids.end(), "land reported more than once");
+    return ids;
+}
+
+/**
+ * @brief 不借助索引，按区块矩形(及高度段)相交判定
+ */
+std::vector<LandID> bruteForce(
+    std::map<LandID, std::shared_ptr<Land>> const& lands,
+    ChunkRect const&                               rect,
+    int                                            minSection,
+    int                                            maxSection,
+    bool                                           ySection
+) {
+    std::vector<LandID> ids;
+    for (auto const& [id, land] : lands) {
+        auto const& aabb = land->getAABB();
+        if (!chunkRectOf(*land).intersects(rect.mMinX, rect.mMaxX, rect.mMinZ, rect.mMaxZ)) {
+            continue;
+        }
+        // 仅分段登记的3D领地按高度段过滤
+        bool const sectioned = ySection && land->is3D() && chunkRectOf(*land).count() <= 16;
+        if (sectioned && ((aabb.max.y >> 4) < minSection || (aabb.min.y >> 4) > maxSection)) {
+            continue;
+        }
+        ids.push_back(id);
+    }
+    return ids;
+}
+
+void checkQueries(
+    LandDimensionChunkMap const&                   map,
+    std::map<LandID, std::shared_ptr<Land>> const& lands,
+    std::mt19937&                                  rng,
+    int                                            count
+) {
+    bool const ySection = map.getOptions().mYSection;
+    for (int i = 0; i < count; ++i) {
+        int const minX = randomIn(rng, -200, 200);
+        int const minZ = randomIn(rng, -200, 200);
+        ChunkRect rect{minX, minX + randomIn(rng, 0, 40), minZ, minZ + randomIn(rng, 0, 40)};
+        int const minSection = randomIn(rng, -4, 19);
+        int const maxSection = randomIn(rng, minSection, 19);
+        LD_EXPECT_MSG(
+            collect(map, rect, minSection, maxSection) == bruteForce(lands, rect, minSection, maxSection, ySection),
+            fmt::format("chunks x[{}, {}] z[{}, {}]", rect.mMinX, rect.mMaxX, rect.mMinZ, rect.mMaxZ)
+        );
+
+        int const x = randomIn(rng, -200, 200);
+        int const z = randomIn(rng, -200, 200);
+        bool      occupied{false};
+        for (auto const& [id, land] : lands) {
+            occupied = occupied || chunkRectOf(*land).intersects(x, x, z, z);
+        }
+        LD_EXPECT_MSG(map.isChunkOccupied(0, x, z) == occupied, fmt::format("chunk ({}, {})", x, z));
+    }
+}
+
+bool sameEntry(LandDimensionChunkMap::ChunkEntry const& a, LandDimensionChunkMap::ChunkEntry const& b) {
+    return a.mLandId == b.mLandId && a.mLevel == b.mLevel && a.mMaskX == b.mMaskX && a.mMaskZ == b.mMaskZ
+        && a.mIs3D == b.mIs3D && a.mFirstX == b.mFirstX && a.mFirstZ == b.mFirstZ
+        && a.mFirstSection == b.mFirstSection;
+}
+
+/**
+ * @brief 比较两个区块桶
+ * 同层级条目的先后取决于登记顺序，增量刷新与完整重建的顺序可能不同，故按 (层级降序, 领地ID) 排序后比较
+ */
+bool sameBucket(LandDimensionChunkMap::ChunkBucket const* a, LandDimensionChunkMap::ChunkBucket const* b) {
+    if (!a || !b) {
+        return a == b;
+    }
+    auto sorted = [](LandDimensionChunkMap::ChunkBucket const& bucket) {
+        std::vector<LandDimensionChunkMap::ChunkEntry> entries{bucket.begin(), bucket.end()};
+        for (size_t i = 1; i < entries.size(); ++i) {
+            LD_EXPECT_MSG(entries[i - 1].mLevel >= entries[i].mLevel, "bucket is not sorted by level");
+        }
+        std::sort(entries.begin(), entries.end(), [](auto const& l, auto const& r) {
+            return l.mLevel != r.mLevel ? l.mLevel > r.mLevel : l.mLandId < r.mLandId;
+        });
+        return entries;
+    };
+    auto lhs = sorted(*a);
+    auto rhs = sorted(*b);
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), sameEntry);
+}
+
+/**
+ * @brief 通过公开查询逐区块比较两份索引
+ */
+void expectSameIndex(LandDimensionChunkMap const& actual, LandDimensionChunkMap const& expected, ChunkRect const& area) {
+    for (int x = area.mMinX; x <= area.mMaxX; ++x) {
+        for (int z = area.mMinZ; z <= area.mMaxZ; ++z) {
+            auto const where = fmt::format("chunk ({}, {})", x, z);
+            LD_EXPECT_MSG(actual.isChunkMarked(0, x, z) == expected.isChunkMarked(0, x, z), where);
+            LD_EXPECT_MSG(actual.isChunkOccupied(0, x, z) == expected.isChunkOccupied(0, x, z), where);
+            LD_EXPECT_MSG(sameBucket(actual.queryLand(0, x, z), expected.queryLand(0, x, z)), where);
+            for (int sy = -5; sy <= 20; ++sy) {
+                LD_EXPECT_MSG(
+                    sameBucket(actual.querySection(0, x, z, sy), expected.querySection(0, x, z, sy)),
+                    fmt::format("{} section {}", where, sy)
+                );
+            }
+        }
+    }
+}
+
+void expectSameRecord(LandDimensionChunkMap const& actual, LandDimensionChunkMap const& expected, LandID id) {
+    auto a = actual.queryRecord(0, id);
+    auto b = expected.queryRecord(0, id);
+    LD_EXPECT(a && b);
+    LD_EXPECT(a->mRect.mMinX == b->mRect.mMinX && a->mRect.mMaxX == b->mRect.mMaxX);
+    LD_EXPECT(a->mRect.mMinZ == b->mRect.mMinZ && a->mRect.mMaxZ == b->mRect.mMaxZ);
+    LD_EXPECT(a->mMinSection == b->mMinSection && a->mMaxSection == b->mMaxSection);
+    LD_EXPECT(a->mLarge == b->mLarge && a->mIs3D == b->mIs3D);
+}
+
+LandDimensionChunkMap::Options largeOptions(bool ySection, bool mortonOrder) {
+    LandDimensionChunkMap::Options options;
+    options.mYSection                = ySection;
+    options.mMortonOrder             = mortonOrder;
+    options.mLargeLandChunkThreshold = 16; // 超过 4x4 区块即为大型领地，便于混合两种登记方式
+    return options;
+}
+
+} // namespace
+
+LD_TEST_CASE(LandDimensionChunkMap_LargeLandQueriesMatchBruteForce) {
+    std::mt19937 rng{6};
+    for (bool ySection : {false, true}) {
+        for (bool mortonOrder : {false, true}) {
+            LandDimensionChunkMap                   map{largeOptions(ySection, mortonOrder)};
+            std::map<LandID, std::shared_ptr<Land>> lands;
+            for (LandID id = 0; id < 400; ++id) {
+                auto land = randomLand(rng, id, id % 4 == 0 ? 600 : 60);
+                map.addLand(land);
+                lands.emplace(id, std::move(land));
+            }
+            checkQueries(map, lands, rng, 2000);
+
+            // 删除一半后剩余领地仍可查询，被删除的领地不再上报
+            for (LandID id = 0; id < 400; id += 2) {
+                map.removeLand(lands.at(id));
+                lands.erase(id);
+            }
+            checkQueries(map, lands, rng, 2000);
+        }
+    }
+}
+
+LD_TEST_CASE(LandDimensionChunkMap_LargeLandTransitions) {
+    for (bool ySection : {false, true}) {
+        for (bool mortonOrder : {false, true}) {
+            LandDimensionChunkMap map{largeOptions(ySection, mortonOrder)};
+
+            // 普通领地扩大为大型领地，再缩小回普通领地
+            auto small = makeLand(1, 3, 5, 40, 50);
+            map.addLand(small);
+            LD_EXPECT(!map.queryRecord(0, 1)->mLarge);
+            LD_EXPECT(map.isChunkMarked(0, 0, 0));
+
+            auto large = makeLand(1, 3, 5, 400, 500);
+            map.refreshRange(large);
+            LD_EXPECT(map.queryRecord(0, 1)->mLarge);
+            LD_EXPECT(!map.isChunkMarked(0, 0, 0)); // 大型领地不登记区块桶
+            LD_EXPECT(!map.hasChunk(0, 0, 0));
+            LD_EXPECT(map.isChunkOccupied(0, 20, 20));
+            LD_EXPECT(!map.isChunkOccupied(0, 30, 20));
+
+            auto moved = makeLand(1, -1000, -1000, -600, -500);
+            map.refreshRange(moved);
+            LD_EXPECT(!map.isChunkOccupied(0, 20, 20));
+            LD_EXPECT(map.isChunkOccupied(0, -40, -40));
+
+            auto shrunk = makeLand(1, -1000, -1000, -990, -990);
+            map.refreshRange(shrunk);
+            LD_EXPECT(!map.queryRecord(0, 1)->mLarge);
+            LD_EXPECT(map.isChunkMarked(0, -63, -63));
+            LD_EXPECT(!map.isChunkOccupied(0, -40, -40));
+
+            std::map<LandID, std::shared_ptr<Land>> lands{{1, shrunk}};
+            std::mt19937                            rng{1};
+            checkQueries(map, lands, rng, 200);
+
+            map.removeLand(shrunk);
+            LD_EXPECT(!map.hasLand(0, 1));
+            LD_EXPECT(!map.isChunkOccupied(0, -63, -63));
+        }
+    }
+}
+
+LD_TEST_CASE(LandDimensionChunkMap_RefreshRangeMatchesRebuild) {
+    enum class Change { Grow, Shrink, Move, To3D, To2D };
+
+    std::mt19937 rng{14};
+    for (bool ySection : {false, true}) {
+        for (bool mortonOrder : {false, true}) {
+            for (int64_t threshold : {0, 64}) {
+                LandDimensionChunkMap::Options options;
+                options.mYSection                = ySection;
+                options.mMortonOrder             = mortonOrder;
+                options.mLargeLandChunkThreshold = threshold;
+
+                // 领地彼此重叠，区块桶内有多个条目；层级随机以覆盖桶内排序
+                LandDimensionChunkMap                   map{options};
+                std::map<LandID, std::shared_ptr<Land>> lands;
+                for (LandID id = 0; id < 40; ++id) {
+                    auto land = randomLand(rng, id, 120);
+                    auto aabb = land->getAABB();
+                    aabb.min.x /= 8, aabb.max.x /= 8, aabb.min.z /= 8, aabb.max.z /= 8; // 收拢到 ±375 格内
+                    land = LandTestAccess::make(id, aabb, land->is3D(), randomIn(rng, 0, 2));
+                    map.addLand(land);
+                    lands.emplace(id, std::move(land));
+                }
+
+                for (int step = 0; step < 300; ++step) {
+                    auto const id     = static_cast<LandID>(randomIn(rng, 0, 39));
+                    auto const change = static_cast<Change>(step % 5);
+                    auto const& prev  = *lands.at(id);
+                    auto        aabb  = prev.getAABB();
+                    bool        is3D  = prev.is3D();
+                    switch (change) {
+                    case Change::Grow:
+                        aabb.min.x -= randomIn(rng, 0, 40), aabb.max.z += randomIn(rng, 0, 40);
+                        aabb.max.x += randomIn(rng, 0, 1); // 仅扩大一格(同一区块内)
+                        break;
+                    case Change::Shrink:
+                        aabb.max.x = randomIn(rng, aabb.min.x, aabb.max.x);
+                        aabb.min.z = randomIn(rng, aabb.min.z, aabb.max.z);
+                        break;
+                    case Change::Move: {
+                        int const dx = randomIn(rng, -80, 80);
+                        int const dz = randomIn(rng, -80, 80);
+                        aabb.min.x += dx, aabb.max.x += dx, aabb.min.z += dz, aabb.max.z += dz;
+                        break;
+                    }
+                    case Change::To3D:
+                        is3D       = true;
+                        aabb.min.y = randomIn(rng, MinY, 250);
+                        aabb.max.y = randomIn(rng, aabb.min.y, MaxY);
+                        break;
+                    case Change::To2D:
+                        is3D       = false;
+                        aabb.min.y = MinY;
+                        aabb.max.y = MaxY;
+                        break;
+                    }
+                    auto next = LandTestAccess::make(id, aabb, is3D, prev.getNestedLevel());
+                    map.refreshRange(next);
+                    lands[id] = std::move(next);
+
+                    if (step % 20 != 19) {
+                        continue;
+                    }
+                    LandDimensionChunkMap rebuilt{options};
+                    for (auto const& [landId, land] : lands) {
+                        rebuilt.addLand(land);
+                    }
+                    for (auto const& [landId, land] : lands) {
+                        expectSameRecord(map, rebuilt, landId);
+                    }
+                    expectSameIndex(map, rebuilt, {-40, 40, -40, 40});
+                }
+            }
+        }
+    }
+}
+
+} // namespace land::test
@@ -0,0 +1,202 @@
+#include "LandTestAccess.h"
+#include "TestRunner.h"
+
+#include "pland/land/repo/internal/LandDimensionChunkMap.h"
+#include "pland/land/repo/internal/LandIndexPersistence.h"
+
+#include "ll/api/io/FileUtils.h"
+
+#include "fmt/core.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace land::test {
+
+namespace {
+
+using internal::LandDimensionChunkMap;
+using internal::LandIndexPersistence;
+
+/**
+ * @brief 测试专用的快照文件，用例结束时删除
+ */
+struct TempIndexFile {
+    std::filesystem::path mPath;
+
+    explicit TempIndexFile(std::string_view name)
+    : mPath(std::filesystem::temp_directory_path() / fmt::format("pland_test_{}.bin", name)) {
+        remove();
+    }
+    ~TempIndexFile() { remove(); }
+
+    void remove() const {
+        std::error_code ec;
+        std::filesystem::remove(mPath, ec);
+    }
+    [[nodiscard]] bool exists() const {
+        std::error_code ec;
+        return std::filesystem::exists(mPath, ec);
+    }
+};
+
+LandDimensionChunkMap::Options testOptions() {
+    LandDimensionChunkMap::Options options;
+    options.mLargeLandChunkThreshold = 16; // 混合按区块登记与大型领地两种方式
+    return options;
+}
+
+/**
+ * @brief 随机生成领地并登记到索引，同时生成层级表
+ */
+void populate(LandDimensionChunkMap& map, LandIndexPersistence::LevelTable& levels, std::mt19937& rng) {
+    auto randomIn = [&](int lo, int hi) { return std::uniform_int_distribution{lo, hi}(rng); };
+    for (LandID id = 0; id < 200; ++id) {
+        int const  x0    = randomIn(-800, 800);
+        int const  z0    = randomIn(-800, 800);
+        int const  size  = id % 5 == 0 ? 300 : 40;
+        bool const is3D  = id % 3 == 0;
+        int const  y0    = is3D ? randomIn(-64, 200) : -64;
+        int const  level = randomIn(0, 3);
+
+        LandAABB aabb;
+        aabb.min = {x0, y0, z0};
+        aabb.max = {x0 + randomIn(0, size), is3D ? y0 + randomIn(0, 60) : 319, z0 + randomIn(0, size)};
+        map.addLand(LandTestAccess::make(id, aabb, is3D, level, static_cast<LandDimid>(id % 3)));
+        levels.emplace_back(id, level);
+    }
+}
+
+bool sameBucket(LandDimensionChunkMap::ChunkBucket const* a, LandDimensionChunkMap::ChunkBucket const* b) {
+    if (!a || !b) {
+        return a == b;
+    }
+    return std::equal(a->begin(), a->end(), b->begin(), b->end(), [](auto const& l, auto const& r) {
+        return l.mLandId == r.mLandId && l.mLevel == r.mLevel && l.mMaskX == r.mMaskX && l.mMaskZ == r.mMaskZ
+            && l.mIs3D == r.mIs3D && l.mFirstX == r.mFirstX && l.mFirstZ == r.mFirstZ
+            && l.mFirstSection == r.mFirstSection;
+    });
+}
+
+uint64_t fingerprintOf(std::vector<std::pair<std::string, std::string>> const& entries) {
+    LandIndexPersistence::Fingerprint fingerprint;
+    for (auto const& [key, value] : entries) {
+        fingerprint.update(key, value);
+    }
+    return fingerprint.value();
+}
+
+} // namespace
+
+LD_TEST_CASE(LandIndexPersistence_RoundTrip) {
+    TempIndexFile file{"index_round_trip"};
+    std::mt19937  rng{16};
+
+    LandDimensionChunkMap            original{testOptions()};
+    LandIndexPersistence::LevelTable levels;
+    populate(original, levels, rng);
+    LD_EXPECT(LandIndexPersistence::save(file.mPath, 0x1234, original, levels));
+
+    LandDimensionChunkMap            restored{testOptions()};
+    LandIndexPersistence::LevelTable restoredLevels;
+    LD_EXPECT(LandIndexPersistence::load(file.mPath, 0x1234, restored, restoredLevels));
+    LD_EXPECT(!file.exists()); // 快照仅使用一次
+    LD_EXPECT(restoredLevels == levels);
+
+    for (LandDimid dim = 0; dim < 3; ++dim) {
+        for (LandID id = 0; id < 200; ++id) {
+            LD_EXPECT(restored.hasLand(dim, id) == original.hasLand(dim, id));
+        }
+        for (int x = -60; x <= 80; ++x) {
+            for (int z = -60; z <= 80; ++z) {
+                auto const where = fmt::format("dim {} chunk ({}, {})", dim, x, z);
+                LD_EXPECT_MSG(restored.isChunkOccupied(dim, x, z) == original.isChunkOccupied(dim, x, z), where);
+                LD_EXPECT_MSG(sameBucket(restored.queryLand(dim, x, z), original.queryLand(dim, x, z)), where);
+                for (int sy = -4; sy <= 19; ++sy) {
+                    LD_EXPECT_MSG(
+                        sameBucket(restored.querySection(dim, x, z, sy), original.querySection(dim, x, z, sy)),
+                        fmt::format("{} section {}", where, sy)
+                    );
+                }
+            }
+        }
+    }
+}
+
+LD_TEST_CASE(LandIndexPersistence_RejectsStaleOrCorrupted) {
+    TempIndexFile file{"index_reject"};
+    std::mt19937  rng{61};
+
+    LandDimensionChunkMap            map{testOptions()};
+    LandIndexPersistence::LevelTable levels;
+    populate(map, levels, rng);
+
+    // 领地数据指纹不一致: 拒绝并删除快照
+    LD_EXPECT(LandIndexPersistence::save(file.mPath, 1, map, levels));
+    {
+        LandDimensionChunkMap            restored{testOptions()};
+        LandIndexPersistence::LevelTable restoredLevels;
+        LD_EXPECT(!LandIndexPersistence::load(file.mPath, 2, restored, restoredLevels));
+        LD_EXPECT(!file.exists());
+    }
+
+    // 负载损坏: 校验和不匹配
+    LD_EXPECT(LandIndexPersistence::save(file.mPath, 1, map, levels));
+    auto data = ll::file_utils::readFile(file.mPath, true);
+    LD_EXPECT(data.has_value());
+    (*data)[data->size() - 5] ^= 0x01;
+    LD_EXPECT(ll::file_utils::writeFile(file.mPath, *data, true));
+    {
+        LandDimensionChunkMap            restored{testOptions()};
+        LandIndexPersistence::LevelTable restoredLevels;
+        LD_EXPECT(!LandIndexPersistence::load(file.mPath, 1, restored, restoredLevels));
+    }
+
+    // 文件截断
+    LD_EXPECT(LandIndexPersistence::save(file.mPath, 1, map, levels));
+    data = ll::file_utils::readFile(file.mPath, true);
+    LD_EXPECT(ll::file_utils::writeFile(file.mPath, std::string_view{*data}.substr(0, data->size() / 2), true));
+    {
+        LandDimensionChunkMap            restored{testOptions()};
+        LandIndexPersistence::LevelTable restoredLevels;
+        LD_EXPECT(!LandIndexPersistence::load(file.mPath, 1, restored, restoredLevels));
+    }
+
+    // 快照不存在
+    LandDimensionChunkMap            restored{testOptions()};
+    LandIndexPersistence::LevelTable restoredLevels;
+    LD_EXPECT(!LandIndexPersistence::load(file.mPath, 1, restored, restoredLevels));
+}
+
+LD_TEST_CASE(LandIndexPersistence_FingerprintDetectsChanges) {
+    std::vector<std::pair<std::string, std::string>> const entries{
+        {"1", R"({"mLandName":"a"})"},
+        {"2", R"({"mLandName":"bb"})"},
+        {"3", R"({"mLandName":"ccc"})"},
+    };
+    auto const base = fingerprintOf(entries);
+    LD_EXPECT(fingerprintOf(entries) == base);
+
+    auto modified         = entries;
+    modified[1].second[2] = 'M';
+    LD_EXPECT(fingerprintOf(modified) != base);
+
+    auto removed = entries;
+    removed.pop_back();
+    LD_EXPECT(fingerprintOf(removed) != base);
+
+    auto added = entries;
+    added.emplace_back("4", "{}");
+    LD_EXPECT(fingerprintOf(added) != base);
+
+    // 键值边界移动后字节序列相同，指纹仍须不同
+    LD_EXPECT(fingerprintOf({{"12", "3"}}) != fingerprintOf({{"1", "23"}}));
+    LD_EXPECT(fingerprintOf({{"", ""}}) != fingerprintOf({}));
+}
+
+} // namespace land::test
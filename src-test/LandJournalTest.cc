@@ -0,0 +1,163 @@
+#include "TestRunner.h"
+
+#include "pland/PLand.h"
+#include "pland/land/repo/LandContext.h"
+#include "pland/land/repo/internal/LandContextCodec.h"
+#include "pland/land/repo/internal/LandJournal.h"
+
+#include "ll/api/io/FileUtils.h"
+
+#include "fmt/core.h"
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace land::test {
+
+namespace {
+
+using internal::LandContextCodec;
+using internal::LandJournal;
+using Op = LandJournal::Op;
+
+struct ReplayedRecord {
+    Op          mOp;
+    LandID      mLandId;
+    std::string mValue;
+};
+
+/**
+ * @brief 测试专用的日志文件，用例结束时删除
+ */
+struct TempJournalFile {
+    std::filesystem::path mPath;
+
+    explicit TempJournalFile(std::string_view name)
+    : mPath(std::filesystem::temp_directory_path() / fmt::format("pland_test_{}.bin", name)) {
+        remove();
+    }
+    ~TempJournalFile() { remove(); }
+
+    void remove() const {
+        std::error_code ec;
+        std::filesystem::remove(mPath, ec);
+        std::filesystem::remove(std::filesystem::path{mPath} += ".tmp", ec);
+    }
+};
+
+LandJournal makeJournal(std::filesystem::path const& file) {
+    return LandJournal{file, std::chrono::milliseconds{1}, PLand::getInstance().getSelf().getLogger()};
+}
+
+std::vector<ReplayedRecord> replayAll(std::filesystem::path const& file) {
+    std::vector<ReplayedRecord> records;
+    auto count = LandJournal::replay(file, [&](LandJournal::Record const& record) {
+        records.push_back({record.mOp, record.mLandId, std::string{record.mValue}});
+    });
+    LD_EXPECT(count == records.size());
+    return records;
+}
+
+} // namespace
+
+LD_TEST_CASE(LandJournal_ReplayAfterCheckpoint) {
+    TempJournalFile file{"journal_checkpoint"};
+    {
+        auto journal = makeJournal(file.mPath);
+        journal.append(Op::SetName, 1, "a");
+        journal.append(Op::AddMember, 2, "00112233-4455-6677-8899-aabbccddeeff");
+        auto const mark = journal.mark();
+        journal.append(Op::SetName, 3, "b");
+        journal.append(Op::Remove, 4);
+        journal.checkpoint(mark); // 仅保留 mark 之后的记录
+        journal.append(Op::SetOwner, 5, "owner");
+    }
+
+    auto const records = replayAll(file.mPath);
+    LD_EXPECT(records.size() == 3);
+    LD_EXPECT(records[0].mOp == Op::SetName && records[0].mLandId == 3 && records[0].mValue == "b");
+    LD_EXPECT(records[1].mOp == Op::Remove && records[1].mLandId == 4 && records[1].mValue.empty());
+    LD_EXPECT(records[2].mOp == Op::SetOwner && records[2].mLandId == 5 && records[2].mValue == "owner");
+
+    // 全部被保存覆盖后日志为空
+    {
+        auto journal = makeJournal(file.mPath);
+        journal.append(Op::SetName, 6, "c");
+        journal.checkpoint(journal.mark());
+    }
+    LD_EXPECT(replayAll(file.mPath).empty());
+}
+
+LD_TEST_CASE(LandJournal_TornTailIsIgnored) {
+    TempJournalFile file{"journal_torn"};
+    {
+        auto journal = makeJournal(file.mPath);
+        for (LandID id = 0; id < 8; ++id) {
+            journal.append(Op::SetName, id, fmt::format("land-{}", id));
+        }
+    }
+    auto data = ll::file_utils::readFile(file.mPath, true);
+    LD_EXPECT(data.has_value());
+
+    // 模拟写入中断: 截去最后一条记录的末尾字节，重放停在最后一条完整记录
+    LD_EXPECT(ll::file_utils::writeFile(file.mPath, std::string_view{*data}.substr(0, data->size() - 3), true));
+    auto records = replayAll(file.mPath);
+    LD_EXPECT(records.size() == 7);
+    LD_EXPECT(records.back().mLandId == 6 && records.back().mValue == "land-6");
+
+    // 校验和不匹配的记录及其后的记录均被丢弃
+    auto corrupted = *data;
+    corrupted[corrupted.size() / 2] ^= 0x5A;
+    LD_EXPECT(ll::file_utils::writeFile(file.mPath, corrupted, true));
+    records = replayAll(file.mPath);
+    LD_EXPECT(records.size() < 8);
+    for (size_t i = 0; i < records.size(); ++i) {
+        LD_EXPECT(records[i].mLandId == static_cast<LandID>(i));
+    }
+}
+
+LD_TEST_CASE(LandJournal_PatchReplayMatchesDirectEdit) {
+    TempJournalFile file{"journal_patch"};
+
+    LandContext base;
+    base.mLandID           = 9;
+    base.mLandOwner        = "00112233-4455-6677-8899-aabbccddeeff";
+    base.mLandName         = "before";
+    base.mPos.min          = {0, -64, 0};
+    base.mPos.max          = {15, 319, 15};
+    base.mTeleportPos      = {1, 64, 1};
+    base.mOriginalBuyPrice = 100;
+
+    // 按领地的修改方式生成补丁记录: 每次修改只编码变化的字段分组
+    auto edited                                    = base;
+    edited.mPos.max                                = {63, 319, 31};
+    edited.mTeleportPos                            = {8, 70, 8};
+    edited.mLandPermTable.environment.allowExplode = !base.mLandPermTable.environment.allowExplode;
+    {
+        auto journal = makeJournal(file.mPath);
+        journal.append(Op::Patch, base.mLandID, LandContextCodec::encode(edited, LandContextCodec::Range));
+        journal.append(Op::Patch, base.mLandID, LandContextCodec::encode(edited, LandContextCodec::Teleport));
+        journal.append(Op::Patch, base.mLandID, LandContextCodec::encode(edited, LandContextCodec::Perms));
+        journal.append(Op::SetName, base.mLandID, "after");
+    }
+    edited.mLandName = "after";
+
+    // 与 LandRegistry 重放日志时相同: 补丁合并到已有数据，其余字段保持原值
+    auto replayed = base;
+    for (auto const& record : replayAll(file.mPath)) {
+        LD_EXPECT(record.mLandId == base.mLandID);
+        if (record.mOp == Op::Patch) {
+            LD_EXPECT(LandContextCodec::decode(record.mValue, replayed));
+        } else if (record.mOp == Op::SetName) {
+            replayed.mLandName = record.mValue;
+        }
+    }
+    LD_EXPECT(LandContextCodec::encode(replayed) == LandContextCodec::encode(edited));
+    LD_EXPECT(replayed.mOriginalBuyPrice == base.mOriginalBuyPrice);
+    LD_EXPECT(replayed.mLandOwner == base.mLandOwner);
+}
+
+} // namespace land::test
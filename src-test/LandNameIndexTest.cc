@@ -0,0 +1,164 @@
+#include "TestRunner.h"
+
+#include "pland/land/repo/internal/LandNameIndex.h"
+
+#include "fmt/core.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace land::test {
+
+namespace {
+
+using internal::LandNameIndex;
+using Ids = std::vector<LandID>;
+
+constexpr auto All = SIZE_MAX;
+
+std::string lower(std::string text) {
+    for (auto& c : text) {
+        if (c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+    }
+    return text;
+}
+
+/**
+ * @brief 不借助倒排表，逐个名称匹配并按文档中的排序规则排序
+ */
+Ids bruteForce(std::map<LandID, std::string> const& names, std::string const& keyword) {
+    std::vector<std::tuple<int, size_t, size_t, LandID>> ranks;
+    auto const                                           needle = lower(keyword);
+    for (auto const& [id, raw] : names) {
+        auto const name = lower(raw);
+        auto const pos  = name.find(needle);
+        if (pos == std::string::npos) {
+            continue;
+        }
+        int const kind = name == needle ? 0 : (pos == 0 ? 1 : 2);
+        ranks.emplace_back(kind, pos, name.size(), id);
+    }
+    std::sort(ranks.begin(), ranks.end());
+
+    Ids ids;
+    for (auto const& rank : ranks) {
+        ids.push_back(std::get<3>(rank));
+    }
+    return ids;
+}
+
+} // namespace
+
+LD_TEST_CASE(LandNameIndex_RankOrder) {
+    LandNameIndex index;
+    index.add(1, "Home");
+    index.add(2, "my home");
+    index.add(3, "HOME");
+    index.add(4, "homestead");
+    index.add(5, "farm");
+    index.add(6, "the homes");
+    index.add(7, "Homes");
+
+    // 完全匹配(ID 升序) > 前缀匹配(名称较短优先) > 子串匹配(位置靠前、名称较短优先)
+    auto all = index.search("home", 0, All);
+    LD_EXPECT(all.mTotal == 6);
+    LD_EXPECT((all.mIds == Ids{1, 3, 7, 4, 2, 6}));
+
+    // 分页结果与完整结果一致
+    auto page = index.search("HOME", 2, 3);
+    LD_EXPECT(page.mTotal == 6);
+    LD_EXPECT((page.mIds == Ids{7, 4, 2}));
+    LD_EXPECT(index.search("home", 6, 10).mIds.empty());
+
+    // 过滤后的总数只计入通过过滤的领地
+    auto filtered = index.search("home", 0, All, [](LandID id) { return id % 2 == 0; });
+    LD_EXPECT(filtered.mTotal == 3);
+    LD_EXPECT((filtered.mIds == Ids{4, 2, 6}));
+
+    // 限定范围的搜索与全量搜索排序一致
+    auto scoped = index.searchIn({2, 4, 5, 7}, "HoMe", 0, All);
+    LD_EXPECT(scoped.mTotal == 3);
+    LD_EXPECT((scoped.mIds == Ids{7, 4, 2}));
+
+    // 不足 3 字节的关键字回退为扫描
+    LD_EXPECT(index.search("fa", 0, All).mIds == Ids{5});
+    LD_EXPECT(index.search("zzz", 0, All).mTotal == 0);
+    LD_EXPECT(index.search("", 0, All).mTotal == 0);
+}
+
+LD_TEST_CASE(LandNameIndex_UpdateAndRemove) {
+    LandNameIndex index;
+    index.add(1, "北方农场");
+    index.add(2, "南方农场");
+    LD_EXPECT((index.search("农场", 0, All).mIds == Ids{1, 2}));
+
+    index.update(1, "北方牧场");
+    LD_EXPECT(index.search("农场", 0, All).mIds == Ids{2});
+    LD_EXPECT(index.search("牧场", 0, All).mIds == Ids{1});
+
+    index.remove(2);
+    LD_EXPECT(index.search("农场", 0, All).mTotal == 0);
+    LD_EXPECT(index.search("南方", 0, All).mTotal == 0);
+
+    index.clear();
+    LD_EXPECT(index.search("牧场", 0, All).mTotal == 0);
+}
+
+LD_TEST_CASE(LandNameIndex_MatchesBruteForce) {
+    std::mt19937 rng{18};
+    auto         randomIn = [&](int lo, int hi) { return std::uniform_int_distribution{lo, hi}(rng); };
+
+    // 小字母表让名称之间大量共享三元组
+    auto randomName = [&] {
+        static constexpr std::string_view Alphabet = "abAB ";
+        std::string                       name;
+        for (int i = randomIn(1, 10); i > 0; --i) {
+            name.push_back(Alphabet[randomIn(0, static_cast<int>(Alphabet.size()) - 1)]);
+        }
+        return name;
+    };
+
+    LandNameIndex                 index;
+    std::map<LandID, std::string> names;
+    for (LandID id = 0; id < 500; ++id) {
+        names[id] = randomName();
+        index.add(id, names[id]);
+    }
+    for (int i = 0; i < 200; ++i) {
+        auto const id = static_cast<LandID>(randomIn(0, 499));
+        if (randomIn(0, 3) == 0) {
+            index.remove(id);
+            names.erase(id);
+        } else {
+            names[id] = randomName();
+            index.update(id, names[id]);
+        }
+    }
+
+    for (int i = 0; i < 200; ++i) {
+        auto const keyword  = randomName().substr(0, static_cast<size_t>(randomIn(1, 5)));
+        auto const expected = bruteForce(names, keyword);
+        auto const result   = index.search(keyword, 0, All);
+        LD_EXPECT_MSG(result.mTotal == expected.size(), fmt::format("keyword '{}'", keyword));
+        LD_EXPECT_MSG(result.mIds == expected, fmt::format("keyword '{}'", keyword));
+
+        // 逐页拼接的结果与一次取出的结果相同
+        Ids        paged;
+        auto const pageSize = static_cast<size_t>(randomIn(5, 40));
+        for (size_t offset = 0; offset < expected.size(); offset += pageSize) {
+            auto page = index.search(keyword, offset, pageSize);
+            paged.insert(paged.end(), page.mIds.begin(), page.mIds.end());
+        }
+        LD_EXPECT_MSG(paged == expected, fmt::format("keyword '{}' page size {}", keyword, pageSize));
+    }
+}
+
+} // namespace land::test
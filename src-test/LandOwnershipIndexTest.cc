@@ -0,0 +1,149 @@
+#include "LandTestAccess.h"
+#include "TestRunner.h"
+
+#include "pland/land/repo/internal/LandOwnershipIndex.h"
+
+#include "mc/platform/UUID.h"
+
+#include "fmt/core.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <random>
+#include <ranges>
+#include <string>
+#include <vector>
+
+namespace land::test {
+
+namespace {
+
+using internal::LandOwnershipIndex;
+
+constexpr int PlayerCount = 12;
+
+mce::UUID playerUuid(int index) { return mce::UUID{0x1000u + static_cast<uint64_t>(index), 0x2000u}; }
+
+/**
+ * @brief 随机设置主人、成员与维度
+ */
+LandContext randomContext(std::mt19937& rng, LandID id) {
+    auto randomIn = [&](int lo, int hi) { return std::uniform_int_distribution{lo, hi}(rng); };
+
+    LandContext context;
+    context.mLandID    = id;
+    context.mLandDimid = randomIn(0, 3);
+    context.mLandOwner = playerUuid(randomIn(0, PlayerCount - 1)).asString();
+    for (int i = 0; i < PlayerCount; ++i) {
+        if (randomIn(0, 5) == 0) {
+            context.mLandMembers.push_back(playerUuid(i).asString());
+        }
+    }
+    return context;
+}
+
+size_t sizeOf(LandOwnershipIndex::LandSet const* set) { return set ? set->size() : 0; }
+
+/**
+ * @brief 按领地当前数据逐个统计，与索引给出的计数与集合比较
+ */
+void expectMatches(LandOwnershipIndex const& index, std::map<LandID, std::shared_ptr<Land>> const& lands) {
+    for (int i = 0; i < PlayerCount; ++i) {
+        auto const uuid = playerUuid(i);
+
+        LandOwnershipIndex::LandSet owned;
+        LandOwnershipIndex::LandSet shared;
+        for (auto const& [id, land] : lands) {
+            if (land->getOwner() == uuid) {
+                owned.insert(id);
+            }
+            if (land->getMembers().contains(uuid)) {
+                shared.insert(id);
+            }
+        }
+        LD_EXPECT_MSG(sizeOf(index.findOwned(uuid)) == owned.size(), fmt::format("player {}", i));
+        LD_EXPECT_MSG(sizeOf(index.findShared(uuid)) == shared.size(), fmt::format("player {}", i));
+        LD_EXPECT_MSG(owned.empty() || *index.findOwned(uuid) == owned, fmt::format("player {}", i));
+        LD_EXPECT_MSG(shared.empty() || *index.findShared(uuid) == shared, fmt::format("player {}", i));
+    }
+    for (LandDimid dim = 0; dim <= 3; ++dim) {
+        auto const count = std::count_if(lands.begin(), lands.end(), [&](auto const& entry) {
+            return entry.second->getDimensionId() == dim;
+        });
+        LD_EXPECT_MSG(sizeOf(index.findInDimension(dim)) == static_cast<size_t>(count), fmt::format("dim {}", dim));
+    }
+
+    // 空集合不保留在索引中，主人计数之和等于领地总数
+    size_t total = 0;
+    for (auto const& set : index.getOwnedMap() | std::views::values) {
+        LD_EXPECT(!set.empty());
+        total += set.size();
+    }
+    LD_EXPECT(total == lands.size());
+}
+
+} // namespace
+
+LD_TEST_CASE(LandOwnershipIndex_CountsMatchBruteForce) {
+    std::mt19937                            rng{17};
+    LandOwnershipIndex                      index;
+    std::map<LandID, std::shared_ptr<Land>> lands;
+    for (LandID id = 0; id < 300; ++id) {
+        auto land = Land::make(randomContext(rng, id));
+        index.add(*land);
+        lands.emplace(id, std::move(land));
+    }
+    expectMatches(index, lands);
+
+    // 修改主人、成员、维度后同步
+    for (LandID id = 0; id < 300; id += 3) {
+        auto& land = *lands.at(id);
+        LandTestAccess::reinit(land, randomContext(rng, id));
+        LD_EXPECT(index.sync(land));
+    }
+    expectMatches(index, lands);
+
+    // 移除领地
+    for (LandID id = 1; id < 300; id += 4) {
+        index.remove(id);
+        lands.erase(id);
+    }
+    index.remove(100000); // 未登记的领地
+    expectMatches(index, lands);
+
+    index.clear();
+    lands.clear();
+    expectMatches(index, lands);
+}
+
+LD_TEST_CASE(LandOwnershipIndex_SyncIgnoresOtherObjects) {
+    std::mt19937       rng{71};
+    LandOwnershipIndex index;
+
+    auto registered = Land::make(randomContext(rng, 1));
+    index.add(*registered);
+    LD_EXPECT(index.contains(*registered));
+
+    // ID 相同但不是登记的对象(例如已被替换的旧对象): 忽略，不改变索引
+    auto context       = registered->_getContext();
+    context.mLandOwner = playerUuid(PlayerCount).asString();
+    auto stale         = Land::make(context);
+    LD_EXPECT(!index.contains(*stale));
+    LD_EXPECT(!index.sync(*stale));
+    LD_EXPECT(index.findOwned(playerUuid(PlayerCount)) == nullptr);
+    LD_EXPECT(sizeOf(index.findOwned(registered->getOwner())) == 1);
+
+    // 未登记的领地
+    auto unregistered = Land::make(randomContext(rng, 2));
+    LD_EXPECT(!index.sync(*unregistered));
+    LD_EXPECT(sizeOf(index.findInDimension(registered->getDimensionId())) == 1);
+
+    // 重新登记同一 ID 的新对象后，旧对象的集合被替换
+    index.add(*stale);
+    LD_EXPECT(index.contains(*stale) && !index.contains(*registered));
+    LD_EXPECT(sizeOf(index.findOwned(playerUuid(PlayerCount))) == 1);
+    LD_EXPECT(index.findOwned(registered->getOwner()) == nullptr);
+}
+
+} // namespace land::test
@@ -0,0 +1,214 @@
+#include "LandTestAccess.h"
+#include "TestRunner.h"
+
+#include "pland/land/repo/internal/LandDimensionChunkMap.h"
+#include "pland/land/repo/internal/LandIndexSnapshot.h"
+#include "pland/land/repo/internal/LandPointQuery.h"
+
+#include "mc/world/level/BlockPos.h"
+
+#include "fmt/core.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace land::test {
+
+namespace {
+
+using internal::LandDimensionChunkMap;
+using internal::LandIndexSnapshot;
+using internal::LandPointQuery;
+
+constexpr int MinY = -64;
+constexpr int MaxY = 319;
+
+struct World {
+    std::vector<std::shared_ptr<Land>> mLands;
+    LandIndexSnapshot                  mIndex;
+};
+
+LandAABB makeBox(int x0, int y0, int z0, int x1, int y1, int z1) {
+    LandAABB aabb;
+    aabb.min = {x0, y0, z0};
+    aabb.max = {x1, y1, z1};
+    return aabb;
+}
+
+int randomIn(std::mt19937& rng, int lo, int hi) { return std::uniform_int_distribution{lo, hi}(rng); }
+
+void addLand(World& world, LandID id, LandAABB const& aabb, bool is3D, int level, LandDimid dimid) {
+    auto land = LandTestAccess::make(id, aabb, is3D, level, dimid);
+    world.mIndex.mLandCache.try_emplace(id, land);
+    world.mIndex.mDimensionChunkMap.addLand(land);
+    world.mLands.push_back(std::move(land));
+}
+
+/**
+ * @brief 在父领地内沿 X 方向切分条带生成互不重叠的子领地，边界不对齐区块以覆盖部分列的情况
+ */
+void spawnChildren(World& world, std::mt19937& rng, Land const& parent, LandID& nextId) {
+    int const level = parent.getNestedLevel() + 1;
+    if (level > 2) {
+        return;
+    }
+    auto const& box   = parent.getAABB();
+    int const   width = box.max.x - box.min.x + 1;
+    int const   count = randomIn(rng, 0, 3);
+    if (count == 0 || width < count * 2) {
+        return;
+    }
+    int const strip = width / count;
+    for (int i = 0; i < count; ++i) {
+        int const stripMin = box.min.x + i * strip;
+        int const x0       = randomIn(rng, stripMin, stripMin + strip - 1);
+        int const x1       = randomIn(rng, x0, stripMin + strip - 1);
+        int const z0       = randomIn(rng, box.min.z, box.max.z);
+        int const z1       = randomIn(rng, z0, box.max.z);
+
+        bool const is3D = parent.is3D() || randomIn(rng, 0, 1) == 1;
+        int        y0   = MinY;
+        int        y1   = MaxY;
+        if (is3D) {
+            y0 = randomIn(rng, box.min.y, box.max.y);
+            y1 = randomIn(rng, y0, std::min(box.max.y, y0 + 40));
+        }
+        auto id = nextId++;
+        addLand(world, id, makeBox(x0, y0, z0, x1, y1, z1), is3D, level, parent.getDimensionId());
+        spawnChildren(world, rng, *world.mLands.back(), nextId);
+    }
+}
+
+World makeWorld(LandDimensionChunkMap::Options options, LandDimid dimid, uint32_t seed) {
+    World world;
+    world.mIndex.mDimensionChunkMap = LandDimensionChunkMap{options};
+
+    std::mt19937 rng{seed};
+    LandID       nextId{0};
+    for (int gx = -4; gx < 4; ++gx) {
+        for (int gz = -4; gz < 4; ++gz) {
+            // 顶层领地互不重叠：每个 160 格网格至多一个，尺寸与位置随机
+            int const  x0   = gx * 160 + randomIn(rng, 0, 40);
+            int const  z0   = gz * 160 + randomIn(rng, 0, 40);
+            int const  x1   = x0 + randomIn(rng, 0, 110);
+            int const  z1   = z0 + randomIn(rng, 0, 110);
+            bool const is3D = randomIn(rng, 0, 2) == 0;
+            int const  y0   = is3D ? randomIn(rng, MinY, 200) : MinY;
+            int const  y1   = is3D ? randomIn(rng, y0, std::min(MaxY, y0 + 80)) : MaxY;
+
+            auto id = nextId++;
+            addLand(world, id, makeBox(x0, y0, z0, x1, y1, z1), is3D, 0, dimid);
+            spawnChildren(world, rng, *world.mLands.back(), nextId);
+        }
+    }
+    return world;
+}
+
+/**
+ * @brief 不借助索引，直接以 AABB 判定坐标所在的最深层领地
+ */
+std::shared_ptr<Land> bruteForce(World const& world, BlockPos const& pos) {
+    std::shared_ptr<Land> best;
+    for (auto const& land : world.mLands) {
+        if (land->getAABB().hasPos(pos, land->is3D())
+            && (!best || land->getNestedLevel() > best->getNestedLevel())) {
+            best = land;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief 校验区块桶内每个条目的列覆盖掩码与 AABB 的二维判定一致
+ */
+void checkMasks(World const& world, LandDimensionChunkMap::ChunkBucket const* bucket, BlockPos const& pos) {
+    if (!bucket) {
+        return;
+    }
+    for (auto const& entry : *bucket) {
+        auto land = world.mIndex.mLandCache.find(entry.mLandId);
+        LD_EXPECT(land != nullptr);
+        LD_EXPECT_MSG(
+            entry.hasColumn(pos.x & 15, pos.z & 15) == (*land)->getAABB().hasPos(pos, false),
+            fmt::format("land {} at ({}, {}, {})", entry.mLandId, pos.x, pos.y, pos.z)
+        );
+    }
+}
+
+void checkPos(World const& world, LandDimid dimid, BlockPos const& pos) {
+    auto const& map = world.mIndex.mDimensionChunkMap;
+    checkMasks(world, map.queryLand(dimid, pos.x >> 4, pos.z >> 4), pos);
+    checkMasks(world, map.querySection(dimid, pos.x >> 4, pos.z >> 4, pos.y >> 4), pos);
+
+    auto expected = bruteForce(world, pos);
+    auto actual   = LandPointQuery::queryAt(world.mIndex, pos, dimid);
+    LD_EXPECT_MSG(
+        (actual ? actual->get() : nullptr) == expected.get(),
+        fmt::format(
+            "({}, {}, {}): expected {}, got {}",
+            pos.x,
+            pos.y,
+            pos.z,
+            expected ? expected->getId() : -1,
+            actual ? (*actual)->getId() : -1
+        )
+    );
+}
+
+void checkWorld(World const& world, LandDimid dimid, uint32_t seed) {
+    std::mt19937 rng{seed};
+    for (auto const& land : world.mLands) {
+        auto const& box = land->getAABB();
+
+        // 领地边界内外各一格(部分覆盖的列)，以及范围内的区块边界(列掩码的首末位)
+        std::vector<int> xs{box.min.x - 1, box.min.x, box.max.x, box.max.x + 1};
+        std::vector<int> zs{box.min.z - 1, box.min.z, box.max.z, box.max.z + 1};
+        for (int x = (box.min.x & ~15) + 16; x <= box.max.x; x += 16) {
+            xs.insert(xs.end(), {x - 1, x});
+        }
+        for (int z = (box.min.z & ~15) + 16; z <= box.max.z; z += 16) {
+            zs.insert(zs.end(), {z - 1, z});
+        }
+        std::vector<int> ys{box.min.y - 1, box.min.y, box.max.y, box.max.y + 1, randomIn(rng, MinY, MaxY)};
+        for (int x : xs) {
+            for (int z : zs) {
+                for (int y : ys) {
+                    checkPos(world, dimid, BlockPos{x, y, z});
+                }
+            }
+        }
+    }
+    for (int i = 0; i < 20000; ++i) {
+        checkPos(
+            world,
+            dimid,
+            BlockPos{randomIn(rng, -700, 700), randomIn(rng, MinY - 1, MaxY + 1), randomIn(rng, -700, 700)}
+        );
+    }
+}
+
+} // namespace
+
+LD_TEST_CASE(LandPointQuery_MaskedLookupMatchesAABB) {
+    uint32_t seed = 1;
+    for (bool ySection : {false, true}) {
+        for (bool mortonOrder : {false, true}) {
+            for (int64_t threshold : {0, 16}) {
+                LandDimensionChunkMap::Options options;
+                options.mYSection                = ySection;
+                options.mMortonOrder             = mortonOrder;
+                options.mLargeLandChunkThreshold = threshold;
+
+                // 交替使用原版维度与自定义维度，覆盖两种维度存储
+                LandDimid const dimid = seed % 2 == 0 ? 0 : 7;
+                auto const      world = makeWorld(options, dimid, seed);
+                checkWorld(world, dimid, seed);
+                ++seed;
+            }
+        }
+    }
+}
+
+} // namespace land::test
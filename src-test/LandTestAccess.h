@@ -0,0 +1,40 @@
+#pragma once
+#include "pland/Global.h"
+#include "pland/aabb/LandAABB.h"
+#include "pland/land/Land.h"
+#include "pland/land/repo/LandContext.h"
+
+#include <memory>
+
+namespace land::test {
+
+/**
+ * @brief 测试用领地构造与私有状态访问
+ */
+struct LandTestAccess {
+    static std::shared_ptr<Land> make(LandID id, LandAABB const& aabb, bool is3D, int level = 0, LandDimid dimid = 0) {
+        LandContext context;
+        context.mLandID    = id;
+        context.mLandDimid = dimid;
+        context.mIs3DLand  = is3D;
+        context.mPos       = aabb;
+
+        auto land = Land::make(std::move(context));
+        land->_setCachedNestedLevel(level);
+        return land;
+    }
+
+    static void setNestedLevel(Land& land, int level) { land._setCachedNestedLevel(level); }
+
+    /**
+     * @brief 替换领地数据，不经过 setter(不写入变更日志，也不同步注册表中的索引)
+     */
+    static void reinit(Land& land, LandContext context) { land._reinit(std::move(context), 0); }
+
+    /**
+     * @brief 压缩冷字段(与 LandRegistry 加载完成后的处理相同)
+     */
+    static void compact(Land& land) { land._compact(); }
+};
+
+} // namespace land::test
@@ -0,0 +1,55 @@
+#include "TestRunner.h"
+
+#include "ll/api/io/Logger.h"
+
+#include "fmt/core.h"
+
+#include <chrono>
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace land::test {
+
+namespace {
+
+std::vector<std::pair<std::string_view, TestFn>>& cases() {
+    static std::vector<std::pair<std::string_view, TestFn>> instance;
+    return instance;
+}
+
+} // namespace
+
+bool registerCase(std::string_view name, TestFn fn) {
+    cases().emplace_back(name, fn);
+    return true;
+}
+
+void fail(std::string_view expr, std::string_view file, int line, std::string const& message) {
+    if (auto pos = file.find_last_of("/\\"); pos != std::string_view::npos) {
+        file.remove_prefix(pos + 1);
+    }
+    throw TestFailure{
+        message.empty() ? fmt::format("{}:{}: {}", file, line, expr)
+                        : fmt::format("{}:{}: {} ({})", file, line, expr, message)
+    };
+}
+
+size_t runAll(ll::io::Logger& logger) {
+    size_t failed = 0;
+    for (auto const& [name, fn] : cases()) {
+        auto begin = std::chrono::steady_clock::now();
+        try {
+            fn();
+            auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin);
+            logger.info("[测试] 通过 {} ({:.1f}ms)", name, elapsed.count());
+        } catch (std::exception const& e) {
+            ++failed;
+            logger.error("[测试] 失败 {}: {}", name, e.what());
+        }
+    }
+    logger.info("[测试] 共 {} 个用例，失败 {} 个", cases().size(), failed);
+    return failed;
+}
+
+} // namespace land::test
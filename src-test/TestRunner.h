@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace ll::io {
+class Logger;
+}
+
+namespace land::test {
+
+using TestFn = void (*)();
+
+struct TestFailure : std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+/**
+ * @brief 注册测试用例(由 LD_TEST_CASE 在静态初始化阶段调用)
+ */
+bool registerCase(std::string_view name, TestFn fn);
+
+/**
+ * @brief 按注册顺序运行全部测试用例
+ * @return 失败的用例数量
+ */
+size_t runAll(ll::io::Logger& logger);
+
+[[noreturn]] void fail(std::string_view expr, std::string_view file, int line, std::string const& message = {});
+
+} // namespace land::test
+
+#define LD_TEST_CASE(NAME)                                                                                             \
+    static void NAME();                                                                                                \
+    [[maybe_unused]] static bool const NAME##Registered = ::land::test::registerCase(#NAME, &NAME);                    \
+    static void NAME()
+
+#define LD_EXPECT(COND)                                                                                                \
+    do {                                                                                                               \
+        if (!(COND)) ::land::test::fail(#COND, __FILE__, __LINE__);                                                    \
+    } while (false)
+
+#define LD_EXPECT_MSG(COND, MESSAGE)                                                                                   \
+    do {                                                                                                               \
+        if (!(COND)) ::land::test::fail(#COND, __FILE__, __LINE__, MESSAGE);                                           \
+    } while (false)
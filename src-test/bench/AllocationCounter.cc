@@ -0,0 +1,60 @@
+#include "BenchUtil.h"
+
+#include <malloc.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#define LD_USABLE_SIZE(ptr) _msize(ptr)
+#else
+#define LD_USABLE_SIZE(ptr) malloc_usable_size(ptr)
+#endif
+
+// 替换本模块的全局 operator new/delete 以统计分配次数与存活字节数(仅 test 构建)。
+// 直接转发到 malloc/free，不添加额外头部：跨模块释放(例如交给 LeviLamina 的对象)与默认实现兼容。
+
+namespace land::test::bench {
+
+namespace {
+
+std::atomic<uint64_t> gCount{0};
+std::atomic<int64_t>  gLive{0};
+std::atomic<int64_t>  gPeak{0};
+
+void* allocate(size_t size) {
+    auto* ptr = std::malloc(size == 0 ? 1 : size);
+    if (!ptr) {
+        throw std::bad_alloc{};
+    }
+    auto const bytes = static_cast<int64_t>(LD_USABLE_SIZE(ptr));
+    auto const live  = gLive.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    gCount.fetch_add(1, std::memory_order_relaxed);
+    auto peak = gPeak.load(std::memory_order_relaxed);
+    while (live > peak && !gPeak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+    return ptr;
+}
+
+void release(void* ptr) noexcept {
+    if (ptr) {
+        gLive.fetch_sub(static_cast<int64_t>(LD_USABLE_SIZE(ptr)), std::memory_order_relaxed);
+        std::free(ptr);
+    }
+}
+
+} // namespace
+
+uint64_t AllocationStats::count() { return gCount.load(std::memory_order_relaxed); }
+int64_t  AllocationStats::liveBytes() { return gLive.load(std::memory_order_relaxed); }
+int64_t  AllocationStats::peakBytes() { return gPeak.load(std::memory_order_relaxed); }
+void     AllocationStats::resetPeak() { gPeak.store(gLive.load(std::memory_order_relaxed), std::memory_order_relaxed); }
+
+} // namespace land::test::bench
+
+void* operator new(size_t size) { return land::test::bench::allocate(size); }
+void* operator new[](size_t size) { return land::test::bench::allocate(size); }
+void  operator delete(void* ptr) noexcept { land::test::bench::release(ptr); }
+void  operator delete[](void* ptr) noexcept { land::test::bench::release(ptr); }
+void  operator delete(void* ptr, size_t) noexcept { land::test::bench::release(ptr); }
+void  operator delete[](void* ptr, size_t) noexcept { land::test::bench::release(ptr); }
@@ -0,0 +1,83 @@
+#include "BaselineIndex.h"
+#include "BenchRunner.h"
+#include "BenchUtil.h"
+
+#include "pland/land/repo/internal/LandIndexSnapshot.h"
+
+#include "ll/api/io/Logger.h"
+
+#include <vector>
+
+namespace land::test::bench {
+
+namespace {
+
+using internal::LandIndexSnapshot;
+
+/**
+ * @brief 与 LandRegistry::forEachLandIn(center, radius, dimid, visitor) 相同，访问器只计数
+ */
+size_t countLandsIn(LandIndexSnapshot const& snapshot, BlockPos const& center, int radius) {
+    size_t count = 0;
+    snapshot.mDimensionChunkMap.forEachLandIn(
+        0,
+        (center.x - radius) >> 4,
+        (center.x + radius) >> 4,
+        (center.z - radius) >> 4,
+        (center.z + radius) >> 4,
+        (center.y - radius) >> 4,
+        (center.y + radius) >> 4,
+        [&](LandID id) {
+            auto land = snapshot.mLandCache.find(id);
+            if (land && (*land)->isCollision(center, radius)) {
+                ++count;
+            }
+            return true;
+        }
+    );
+    return count;
+}
+
+} // namespace
+
+/**
+ * 范围查询: 基线 getLandAt(center, radius) 构造结果集合 vs forEachLandIn 逐个回调
+ * 中心点取自领地边缘 ±8 格内，使查询范围跨越领地边界
+ */
+LD_BENCH_CASE(Bench_AreaQuery) {
+    auto const lands = makeGridWorld(50000);
+
+    BaselineIndex baseline;
+    auto          snapshot = std::make_shared<LandIndexSnapshot>();
+    for (auto const& land : lands) {
+        baseline.addLand(land);
+    }
+    addToSnapshot(*snapshot, lands);
+
+    std::mt19937          rng{5};
+    std::vector<BlockPos> centers;
+    for (int i = 0; i < 20000; ++i) {
+        auto const& box    = lands[rng() % lands.size()]->getAABB();
+        auto const  offset = std::uniform_int_distribution{-8, 8}(rng);
+        centers.push_back({box.min.x + offset, 64, std::uniform_int_distribution{box.min.z, box.max.z}(rng)});
+    }
+
+    for (int radius : {8, 64, 256}) {
+        auto const base = measurePerCall(centers, [&](BlockPos const& center) {
+            return baseline.getLandAt(center, radius, 0).size();
+        });
+        auto const current = measurePerCall(centers, [&](BlockPos const& center) {
+            return countLandsIn(*snapshot, center, radius);
+        });
+        logger.info(
+            "半径 {}: 基线 {:.0f}ns ({:.2f} 次分配), forEachLandIn {:.0f}ns ({:.2f} 次分配)",
+            radius,
+            base.mNs,
+            base.mAllocs,
+            current.mNs,
+            current.mAllocs
+        );
+    }
+}
+
+} // namespace land::test::bench
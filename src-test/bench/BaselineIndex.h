@@ -0,0 +1,145 @@
+#pragma once
+#include "pland/Global.h"
+#include "pland/land/Land.h"
+#include "pland/land/repo/internal/BidirectionalMap.h"
+#include "pland/land/repo/internal/ChunkEncoder.h"
+
+#include "mc/world/level/BlockPos.h"
+
+#include "absl/container/flat_hash_map.h"
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+
+namespace land::test::bench {
+
+/**
+ * @brief 引入快照索引之前的领地索引，作为基准的对照组
+ * 与 baseline 提交中的 LandRegistry::getLandAt / LandDimensionChunkMap 逐行对应:
+ * 领地缓存为 flat_hash_map，区块映射为每维度一个 BidirectionalMap<ChunkID, LandID>，查询持有共享锁。
+ * @note 登记时逐区块插入，省略了 LandAABB::getChunks() 构造的临时集合
+ */
+class BaselineIndex {
+public:
+    using LandSet = std::unordered_set<std::shared_ptr<Land>>;
+
+    void addLand(std::shared_ptr<Land> const& land) {
+        std::unique_lock lock(mMutex);
+        mLandCache.emplace(land->getId(), land);
+        _registerChunks(*land);
+    }
+
+    /**
+     * @brief 重新登记领地范围(基线的 refreshLandRange: 删除全部区块后重新添加)
+     */
+    void refreshRange(std::shared_ptr<Land> const& land) {
+        std::unique_lock lock(mMutex);
+        auto&            dim = mDimensionChunkMap[land->getDimensionId()];
+        if (dim.has_value(land->getId())) {
+            auto const chunks = dim.reverse_at(land->getId());
+            for (auto chunkId : chunks) {
+                dim.erase_value(chunkId, land->getId());
+            }
+        }
+        _registerChunks(*land);
+    }
+
+    [[nodiscard]] std::shared_ptr<Land> getLandAt(BlockPos const& pos, LandDimid dimid) const {
+        std::shared_lock lock(mMutex);
+        LandSet          result;
+
+        auto landIds = _queryLand(dimid, internal::ChunkEncoder::encode(pos.x >> 4, pos.z >> 4));
+        if (!landIds) {
+            return nullptr;
+        }
+        for (auto const& id : *landIds) {
+            if (auto iter = mLandCache.find(id); iter != mLandCache.end()) {
+                if (auto const& land = iter->second; land->getAABB().hasPos(pos, land->is3D())) {
+                    result.insert(land);
+                }
+            }
+        }
+        if (result.empty()) {
+            return nullptr;
+        }
+        if (result.size() == 1) {
+            return *result.begin();
+        }
+        std::shared_ptr<Land> deepest;
+        int                   maxLevel = -1;
+        for (auto const& land : result) {
+            if (land->getNestedLevel() > maxLevel) {
+                maxLevel = land->getNestedLevel();
+                deepest  = land;
+            }
+        }
+        return deepest;
+    }
+
+    [[nodiscard]] LandSet getLandAt(BlockPos const& center, int radius, LandDimid dimid) const {
+        std::shared_lock lock(mMutex);
+        if (!mDimensionChunkMap.contains(dimid)) {
+            return {};
+        }
+
+        std::unordered_set<internal::ChunkID> visitedChunks;
+        LandSet                               lands;
+        for (int x = (center.x - radius) >> 4; x <= (center.x + radius) >> 4; ++x) {
+            for (int z = (center.z - radius) >> 4; z <= (center.z + radius) >> 4; ++z) {
+                auto const chunkId = internal::ChunkEncoder::encode(x, z);
+                if (!visitedChunks.insert(chunkId).second) {
+                    continue;
+                }
+                auto landIds = _queryLand(dimid, chunkId);
+                if (!landIds) {
+                    continue;
+                }
+                for (auto const& id : *landIds) {
+                    if (auto iter = mLandCache.find(id); iter != mLandCache.end()) {
+                        if (auto const& land = iter->second; land->isCollision(center, radius)) {
+                            lands.insert(land);
+                        }
+                    }
+                }
+            }
+        }
+        return lands;
+    }
+
+    /**
+     * @brief 领地读写锁(基线的保存任务在序列化全部领地期间持有共享锁)
+     */
+    [[nodiscard]] std::shared_mutex& mutex() const { return mMutex; }
+
+    [[nodiscard]] absl::flat_hash_map<LandID, std::shared_ptr<Land>> const& lands() const { return mLandCache; }
+
+private:
+    using ChunkLandMap = internal::BidirectionalMap<internal::ChunkID, LandID>;
+
+    void _registerChunks(Land const& land) {
+        auto const& box = land.getAABB();
+        auto&       dim = mDimensionChunkMap[land.getDimensionId()];
+        for (int x = box.min.x >> 4; x <= box.max.x >> 4; ++x) {
+            for (int z = box.min.z >> 4; z <= box.max.z >> 4; ++z) {
+                dim.insert(internal::ChunkEncoder::encode(x, z), land.getId());
+            }
+        }
+    }
+
+    [[nodiscard]] ChunkLandMap::ValuesSet const* _queryLand(LandDimid dimid, internal::ChunkID chunkId) const {
+        auto dim = mDimensionChunkMap.find(dimid);
+        if (dim == mDimensionChunkMap.end()) {
+            return nullptr;
+        }
+        auto chunk = dim->second.forward_map().find(chunkId);
+        return chunk == dim->second.forward_map().end() ? nullptr : &chunk->second;
+    }
+
+    absl::flat_hash_map<LandID, std::shared_ptr<Land>> mLandCache;
+    absl::flat_hash_map<LandDimid, ChunkLandMap>       mDimensionChunkMap;
+    mutable std::shared_mutex                          mMutex;
+};
+
+} // namespace land::test::bench
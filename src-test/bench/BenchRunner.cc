@@ -0,0 +1,49 @@
+#include "BenchRunner.h"
+
+#include "ll/api/io/Logger.h"
+
+#include <chrono>
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace land::test {
+
+namespace {
+
+std::vector<std::pair<std::string_view, BenchFn>>& benches() {
+    static std::vector<std::pair<std::string_view, BenchFn>> instance;
+    return instance;
+}
+
+} // namespace
+
+bool registerBench(std::string_view name, BenchFn fn) {
+    benches().emplace_back(name, fn);
+    return true;
+}
+
+size_t runBenchmarks(ll::io::Logger& logger, std::string_view filter) {
+    size_t count = 0;
+    for (auto const& [name, fn] : benches()) {
+        if (!filter.empty() && name.find(filter) == std::string_view::npos) {
+            continue;
+        }
+        ++count;
+        logger.info("[基准] {}", name);
+        auto begin = std::chrono::steady_clock::now();
+        try {
+            fn(logger);
+            auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin);
+            logger.info("[基准] {} 完成 ({:.1f}s)", name, elapsed.count());
+        } catch (std::exception const& e) {
+            logger.error("[基准] {} 异常: {}", name, e.what());
+        }
+    }
+    if (count == 0) {
+        logger.warn("[基准] 没有名称包含 \"{}\" 的基准", filter);
+    }
+    return count;
+}
+
+} // namespace land::test
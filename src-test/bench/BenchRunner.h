@@ -0,0 +1,30 @@
+#pragma once
+#include <cstddef>
+#include <string_view>
+
+namespace ll::io {
+class Logger;
+}
+
+namespace land::test {
+
+using BenchFn = void (*)(ll::io::Logger&);
+
+/**
+ * @brief 注册基准(由 LD_BENCH_CASE 在静态初始化阶段调用)
+ */
+bool registerBench(std::string_view name, BenchFn fn);
+
+/**
+ * @brief 按注册顺序运行名称包含 filter 的基准(filter 为空时运行全部)
+ * @note 基准不在插件加载时运行，由控制台命令 `pland bench [name]` 在服务器线程上触发
+ * @return 运行的基准数量
+ */
+size_t runBenchmarks(ll::io::Logger& logger, std::string_view filter);
+
+} // namespace land::test
+
+#define LD_BENCH_CASE(NAME)                                                                                            \
+    static void NAME(ll::io::Logger& logger);                                                                          \
+    [[maybe_unused]] static bool const NAME##Registered = ::land::test::registerBench(#NAME, &NAME);                   \
+    static void NAME([[maybe_unused]] ll::io::Logger& logger)
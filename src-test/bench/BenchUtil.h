@@ -0,0 +1,183 @@
+#pragma once
+#include "LandTestAccess.h"
+
+#include "pland/land/repo/LandContext.h"
+#include "pland/land/repo/internal/LandIndexSnapshot.h"
+
+#include "mc/platform/UUID.h"
+#include "mc/world/level/BlockPos.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace land::test::bench {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief 全局 operator new/delete 的统计(见 AllocationCounter.cc)
+ * @note 仅统计本模块内的分配；存活字节数只适合在基准内部取差值
+ */
+struct AllocationStats {
+    [[nodiscard]] static uint64_t count();     // 累计分配次数
+    [[nodiscard]] static int64_t  liveBytes(); // 当前存活字节数
+    [[nodiscard]] static int64_t  peakBytes(); // 上次 resetPeak 以来的存活字节数峰值
+    static void                   resetPeak();
+};
+
+/**
+ * @brief 生成互不重叠的普通领地: 按网格放置(默认边长 256 格)，领地边长 16~215 格随机，网格以原点为中心
+ */
+inline std::vector<std::shared_ptr<Land>> makeGridWorld(size_t count, uint32_t seed = 42, int cellSize = 256) {
+    std::mt19937 rng{seed};
+    auto         randomIn = [&](int lo, int hi) { return std::uniform_int_distribution{lo, hi}(rng); };
+
+    int const side = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(count))));
+
+    std::vector<std::shared_ptr<Land>> lands;
+    lands.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        int const cellX = static_cast<int>(i % side) - side / 2;
+        int const cellZ = static_cast<int>(i / side) - side / 2;
+        int const width = randomIn(16, 215);
+        int const depth = randomIn(16, 215);
+        int const x0    = cellX * cellSize + randomIn(0, cellSize - width - 1);
+        int const z0    = cellZ * cellSize + randomIn(0, cellSize - depth - 1);
+
+        LandAABB aabb;
+        aabb.min = {x0, -64, z0};
+        aabb.max = {x0 + width - 1, 319, z0 + depth - 1};
+        lands.push_back(LandTestAccess::make(static_cast<LandID>(i), aabb, false));
+    }
+    return lands;
+}
+
+/**
+ * @brief 每 4 个领地生成一个 8x8x20 的 3D 子领地(嵌套层级 1)
+ */
+inline std::vector<std::shared_ptr<Land>> makeSubLands(std::vector<std::shared_ptr<Land>> const& parents) {
+    std::vector<std::shared_ptr<Land>> subs;
+    auto                               nextId = static_cast<LandID>(parents.size());
+    for (size_t i = 0; i < parents.size(); i += 4) {
+        auto const& box = parents[i]->getAABB();
+
+        LandAABB aabb;
+        aabb.min = {box.min.x + 2, 60, box.min.z + 2};
+        aabb.max = {box.min.x + 9, 79, box.min.z + 9};
+        subs.push_back(LandTestAccess::make(nextId++, aabb, true, 1));
+    }
+    return subs;
+}
+
+/**
+ * @brief 生成用于编码与加载测试的领地数据: 随机坐标，0~3 个成员，三分之一带自定义名称，十分之一修改过权限
+ */
+inline std::vector<LandContext> makeContexts(size_t count, uint64_t seed = 7) {
+    std::mt19937_64 rng{seed};
+    auto            uuid = [&] { return mce::UUID{rng(), rng()}.asString(); };
+
+    std::vector<LandContext> contexts(count);
+    for (size_t i = 0; i < count; ++i) {
+        auto&     context = contexts[i];
+        int const x       = static_cast<int>(rng() % 200000) - 100000;
+        int const z       = static_cast<int>(rng() % 200000) - 100000;
+
+        context.mPos.min     = {x, -64, z};
+        context.mPos.max     = {x + static_cast<int>(rng() % 64), 319, z + static_cast<int>(rng() % 64)};
+        context.mTeleportPos = {x + 1, 70, z + 1};
+        context.mLandID      = static_cast<LandID>(i);
+        context.mLandDimid   = static_cast<LandDimid>(rng() % 3);
+        context.mLandOwner   = uuid();
+        for (auto m = rng() % 4; m > 0; --m) {
+            context.mLandMembers.push_back(uuid());
+        }
+        context.mLandName         = i % 3 == 0 ? "玩家的小屋" : "Unnamed territories";
+        context.mOriginalBuyPrice = static_cast<int>(rng() % 10000);
+        if (i % 10 == 0) {
+            context.mLandPermTable.environment.allowExplode = true;
+        }
+    }
+    return contexts;
+}
+
+inline void addToSnapshot(internal::LandIndexSnapshot& index, std::vector<std::shared_ptr<Land>> const& lands) {
+    for (auto const& land : lands) {
+        index.mLandCache.try_emplace(land->getId(), land);
+        index.mDimensionChunkMap.addLand(land);
+    }
+}
+
+/**
+ * @brief 领地内随机坐标(Y 固定为 64)
+ */
+inline BlockPos randomPosIn(Land const& land, std::mt19937& rng) {
+    auto const& box = land.getAABB();
+    return {
+        std::uniform_int_distribution{box.min.x, box.max.x}(rng),
+        64,
+        std::uniform_int_distribution{box.min.z, box.max.z}(rng)
+    };
+}
+
+/**
+ * @brief 防止编译器优化掉基准结果
+ */
+template <typename T>
+inline void keep(T const& value) {
+    static volatile uint64_t sink;
+    sink = sink + static_cast<uint64_t>(value);
+}
+
+/**
+ * @brief 对每个输入执行 fn，先预热一轮，再计时 rounds 轮
+ * @return 平均每次调用的纳秒数与分配次数
+ */
+struct PerCall {
+    double mNs{0};
+    double mAllocs{0};
+};
+template <typename T, typename Fn>
+inline PerCall measurePerCall(std::vector<T> const& inputs, Fn&& fn, int rounds = 5) {
+    for (auto const& input : inputs) {
+        keep(fn(input));
+    }
+    auto const allocs = AllocationStats::count();
+    auto const begin  = Clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        for (auto const& input : inputs) {
+            keep(fn(input));
+        }
+    }
+    auto const   elapsed = std::chrono::duration<double, std::nano>(Clock::now() - begin).count();
+    double const calls   = static_cast<double>(rounds) * static_cast<double>(inputs.size());
+    return {elapsed / calls, static_cast<double>(AllocationStats::count() - allocs) / calls};
+}
+
+template <typename Fn>
+inline double elapsedMs(Fn&& fn) {
+    auto const begin = Clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+}
+
+/**
+ * @brief 百分位数(最近秩法)，会重排 samples
+ */
+inline double percentile(std::vector<double>& samples, double p) {
+    if (samples.empty()) {
+        return 0;
+    }
+    auto const rank = static_cast<size_t>(std::ceil(p / 100.0 * static_cast<double>(samples.size())));
+    auto const nth  = samples.begin() + static_cast<std::ptrdiff_t>(std::clamp<size_t>(rank, 1, samples.size()) - 1);
+    std::nth_element(samples.begin(), nth, samples.end());
+    return *nth;
+}
+
+inline double toMB(int64_t bytes) { return static_cast<double>(bytes) / (1024.0 * 1024.0); }
+
+} // namespace land::test::bench
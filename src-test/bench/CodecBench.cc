@@ -0,0 +1,107 @@
+#include "BenchRunner.h"
+#include "BenchUtil.h"
+
+#include "pland/land/repo/LandContext.h"
+#include "pland/land/repo/internal/LandContextCodec.h"
+#include "pland/land/repo/internal/LandContextJsonReader.h"
+#include "pland/utils/JsonUtil.h"
+
+#include "ll/api/io/Logger.h"
+
+#include "nlohmann/json.hpp"
+
+#include <string>
+#include <vector>
+
+namespace land::test::bench {
+
+namespace {
+
+using internal::LandContextCodec;
+using internal::LandContextJsonReader;
+
+double averageSize(std::vector<std::string> const& data) {
+    size_t bytes = 0;
+    for (auto const& item : data) {
+        bytes += item.size();
+    }
+    return static_cast<double>(bytes) / static_cast<double>(data.size());
+}
+
+} // namespace
+
+/**
+ * 领地数据编码: JSON(反射序列化 + dump，与保存路径相同) vs LandContextCodec 二进制
+ * JSON 编码分别统计 DOM 构建(struct2json)与文本输出(dump)；JSON 解码分别统计流式解析与 DOM 解析 + 反序列化
+ */
+LD_BENCH_CASE(Bench_LandCodec) {
+    auto const contexts = makeContexts(20000);
+
+    std::vector<std::string>            binary, json;
+    std::vector<nlohmann::ordered_json> doms;
+    for (auto const& context : contexts) {
+        binary.push_back(LandContextCodec::encode(context));
+        doms.push_back(json_util::struct2json(context));
+        json.push_back(doms.back().dump());
+    }
+
+    auto const domBuild  = measurePerCall(contexts, [](LandContext const& context) {
+        return json_util::struct2json(context).size();
+    });
+    auto const dump      = measurePerCall(doms, [](nlohmann::ordered_json const& dom) { return dom.dump().size(); });
+    auto const binEncode = measurePerCall(contexts, [](LandContext const& context) {
+        return LandContextCodec::encode(context).size();
+    });
+
+    auto const binDecode    = measurePerCall(binary, [](std::string const& data) {
+        LandContext context;
+        return LandContextCodec::decode(data, context);
+    });
+    auto const streamDecode = measurePerCall(json, [](std::string const& data) {
+        LandContext context;
+        return LandContextJsonReader::read(data, context);
+    });
+    auto const domParse     = measurePerCall(json, [](std::string const& data) {
+        return nlohmann::json::parse(data).size();
+    });
+    auto const domDecode    = measurePerCall(json, [](std::string const& data) {
+        // 与 LandRegistry 加载 JSON 领地相同: 解析后以当前结构为底合并，再反序列化
+        auto        dom = nlohmann::json::parse(data);
+        LandContext context;
+        json_util::json2structWithVersionPatch(dom, context, true);
+        return context.mLandID;
+    });
+
+    logger.info(
+        "每领地字节数: JSON {:.1f}, 二进制 {:.1f} ({:.1f}%)",
+        averageSize(json),
+        averageSize(binary),
+        100.0 * averageSize(binary) / averageSize(json)
+    );
+    logger.info(
+        "JSON 编码: struct2json {:.0f}ns ({:.1f} 次分配), dump {:.0f}ns ({:.1f} 次分配)",
+        domBuild.mNs,
+        domBuild.mAllocs,
+        dump.mNs,
+        dump.mAllocs
+    );
+    logger.info(
+        "JSON 解码: 流式 {:.0f}ns ({:.1f} 次分配), DOM 解析 {:.0f}ns ({:.1f} 次分配), "
+        "DOM 解析 + 反序列化 {:.0f}ns ({:.1f} 次分配)",
+        streamDecode.mNs,
+        streamDecode.mAllocs,
+        domParse.mNs,
+        domParse.mAllocs,
+        domDecode.mNs,
+        domDecode.mAllocs
+    );
+    logger.info(
+        "二进制: 编码 {:.0f}ns ({:.1f} 次分配), 解码 {:.0f}ns ({:.1f} 次分配)",
+        binEncode.mNs,
+        binEncode.mAllocs,
+        binDecode.mNs,
+        binDecode.mAllocs
+    );
+}
+
+} // namespace land::test::bench
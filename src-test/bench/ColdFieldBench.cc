@@ -0,0 +1,82 @@
+#include "BenchRunner.h"
+#include "BenchUtil.h"
+
+#include "pland/land/Land.h"
+#include "pland/land/repo/LandContext.h"
+
+#include "ll/api/io/Logger.h"
+
+#include "mc/platform/UUID.h"
+
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace land::test::bench {
+
+namespace {
+
+constexpr size_t LandCount = 50000;
+
+} // namespace
+
+/**
+ * 冷字段(成员名单)按需展开: 压缩前后的领地内存，压缩、首次展开与成员判断的耗时
+ */
+LD_BENCH_CASE(Bench_ColdFields) {
+    auto const contexts = makeContexts(LandCount, 11);
+
+    // 成员判断的输入: 有成员的领地取其首个成员，否则取随机 UUID(未命中)
+    std::mt19937_64                           rng{11};
+    std::vector<std::pair<size_t, mce::UUID>> probes;
+    for (size_t i = 0; i < contexts.size(); ++i) {
+        auto const& members = contexts[i].mLandMembers;
+        probes.emplace_back(i, members.empty() ? mce::UUID{rng(), rng()} : mce::UUID::fromString(members.front()));
+    }
+
+    std::vector<std::shared_ptr<Land>> lands;
+    lands.reserve(contexts.size());
+
+    auto const live = AllocationStats::liveBytes();
+    for (auto const& context : contexts) {
+        lands.push_back(Land::make(context));
+    }
+    auto const hydrated = AllocationStats::liveBytes() - live;
+
+    auto const compactMs = elapsedMs([&] {
+        for (auto const& land : lands) {
+            LandTestAccess::compact(*land);
+        }
+    });
+    auto const compacted = AllocationStats::liveBytes() - live;
+
+    auto const isMember = measurePerCall(probes, [&](std::pair<size_t, mce::UUID> const& probe) {
+        return lands[probe.first]->isMember(probe.second);
+    });
+
+    auto const hydrateMs = elapsedMs([&] {
+        for (auto const& land : lands) {
+            keep(land->getMembers().size());
+        }
+    });
+
+    auto const perLand = [&](double value) { return value / static_cast<double>(lands.size()); };
+    logger.info(
+        "领地 {} 个: 全部展开 {:.2f} MB (每领地 {:.0f} B), 成员名单已压缩 {:.2f} MB (每领地 {:.0f} B)",
+        lands.size(),
+        toMB(hydrated),
+        perLand(static_cast<double>(hydrated)),
+        toMB(compacted),
+        perLand(static_cast<double>(compacted))
+    );
+    logger.info(
+        "压缩 {:.0f}ns/个 (合计 {:.0f}ms), 首次展开 {:.0f}ns/个, 成员判断(不展开) {:.0f}ns",
+        perLand(compactMs * 1e6),
+        compactMs,
+        perLand(hydrateMs * 1e6),
+        isMember.mNs
+    );
+}
+
+} // namespace land::test::bench
@@ -0,0 +1,66 @@
+#include "BaselineIndex.h"
+#include "BenchRunner.h"
+#include "BenchUtil.h"
+
+#include "pland/land/repo/internal/LandDimensionChunkMap.h"
+#include "pland/land/repo/internal/LandIndexSnapshot.h"
+
+#include "ll/api/io/Logger.h"
+
+#include <memory>
+#include <vector>
+
+namespace land::test::bench {
+
+namespace {
+
+using internal::LandDimensionChunkMap;
+using internal::LandIndexSnapshot;
+
+template <typename Build>
+void logMemory(ll::io::Logger& logger, char const* name, size_t landCount, Build&& build) {
+    auto const live   = AllocationStats::liveBytes();
+    auto const index  = build();
+    auto const memory = AllocationStats::liveBytes() - live;
+    logger.info(
+        "{}: {:.1f} MB, 每领地 {:.0f} B",
+        name,
+        toMB(memory),
+        static_cast<double>(memory) / static_cast<double>(landCount)
+    );
+}
+
+} // namespace
+
+/**
+ * 索引存活内存(领地缓存 + 区块映射，不含领地对象本身)
+ */
+LD_BENCH_CASE(Bench_IndexMemory) {
+    auto lands = makeGridWorld(50000);
+    auto subs  = makeSubLands(lands);
+    lands.insert(lands.end(), subs.begin(), subs.end());
+
+    logMemory(logger, "基线 (BidirectionalMap)", lands.size(), [&] {
+        auto index = std::make_unique<BaselineIndex>();
+        for (auto const& land : lands) {
+            index->addLand(land);
+        }
+        return index;
+    });
+    logMemory(logger, "紧凑区块桶", lands.size(), [&] {
+        auto index = std::make_unique<LandIndexSnapshot>();
+        addToSnapshot(*index, lands);
+        return index;
+    });
+    logMemory(logger, "紧凑区块桶 (Morton 有序存储)", lands.size(), [&] {
+        LandDimensionChunkMap::Options options;
+        options.mMortonOrder = true;
+
+        auto index                = std::make_unique<LandIndexSnapshot>();
+        index->mDimensionChunkMap = LandDimensionChunkMap{options};
+        addToSnapshot(*index, lands);
+        return index;
+    });
+}
+
+} // namespace land::test::bench
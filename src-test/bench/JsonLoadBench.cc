@@ -0,0 +1,81 @@
+#include "BenchRunner.h"
+#include "BenchUtil.h"
+
+#include "pland/land/repo/LandContext.h"
+#include "pland/land/repo/internal/LandContextJsonReader.h"
+#include "pland/utils/JsonUtil.h"
+
+#include "ll/api/io/Logger.h"
+
+#include "nlohmann/json.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace land::test::bench {
+
+namespace {
+
+constexpr size_t RecordCount = 20000;
+
+std::vector<std::string> makeRecords() {
+    std::vector<std::string> records;
+    for (auto const& context : makeContexts(RecordCount)) {
+        records.push_back(json_util::struct2json(context).dump());
+    }
+    return records;
+}
+
+/**
+ * @brief 单线程解码全部原始数据，记录耗时与内存(含原始数据与解码结果)
+ */
+template <typename Decode>
+void logLoad(ll::io::Logger& logger, char const* name, Decode&& decode) {
+    auto const base    = AllocationStats::liveBytes();
+    auto       records = makeRecords();
+    auto const raw     = AllocationStats::liveBytes() - base;
+
+    std::vector<LandContext> contexts;
+    contexts.reserve(records.size());
+    AllocationStats::resetPeak();
+
+    auto const ms = elapsedMs([&] {
+        for (auto& record : records) {
+            contexts.push_back(decode(record));
+        }
+    });
+    logger.info(
+        "{}: 每领地 {:.0f}ns, 总耗时 {:.0f}ms, 原始数据 {:.1f} MB, 峰值 {:.1f} MB, 解码结束时存活 {:.1f} MB",
+        name,
+        ms * 1e6 / static_cast<double>(records.size()),
+        ms,
+        toMB(raw),
+        toMB(AllocationStats::peakBytes() - base),
+        toMB(AllocationStats::liveBytes() - base)
+    );
+}
+
+} // namespace
+
+/**
+ * 加载阶段 JSON 解码: DOM 解析 + 反序列化(保留全部原始数据) vs LandContextJsonReader 流式解析(解码后立即释放原始数据)
+ */
+LD_BENCH_CASE(Bench_JsonLoad) {
+    logLoad(logger, "DOM", [](std::string const& record) {
+        auto        json = nlohmann::json::parse(record);
+        LandContext context;
+        json_util::json2structWithVersionPatch(json, context, true);
+        return context;
+    });
+    logLoad(logger, "流式", [](std::string& record) {
+        auto raw     = std::move(record); // 与 LandRegistry::Impl::_loadLands 相同
+        auto context = LandContext{.mLandName = {}};
+        if (!internal::LandContextJsonReader::read(raw, context)) {
+            throw std::runtime_error{"LandContextJsonReader failed"};
+        }
+        return context;
+    });
+}
+
+} // namespace land::test::bench
@@ -0,0 +1,153 @@
+#include "BenchRunner.h"
+#include "BenchUtil.h"
+
+#include "pland/land/repo/internal/LandDimensionChunkMap.h"
+#include "pland/land/repo/internal/LandIndexSnapshot.h"
+#include "pland/land/repo/internal/LandPointQuery.h"
+
+#include "ll/api/io/Logger.h"
+
+#include <memory>
+#include <vector>
+
+namespace land::test::bench {
+
+namespace {
+
+using internal::LandDimensionChunkMap;
+using internal::LandIndexSnapshot;
+using internal::LandPointQuery;
+
+constexpr int64_t DefaultThreshold = LandDimensionChunkMap::Options{}.mLargeLandChunkThreshold;
+
+std::shared_ptr<Land> makeSquare(LandID id, int x0, int z0, int side) {
+    LandAABB aabb;
+    aabb.min = {x0, -64, z0};
+    aabb.max = {x0 + side - 1, 319, z0 + side - 1};
+    return LandTestAccess::make(id, aabb, false);
+}
+
+/**
+ * @brief 普通领地之外，每 1000 个领地加入一个边长 2048~4096 格的大型领地(128x128~256x256 区块)
+ * 大型领地在普通领地网格以外按每行 10 个排列
+ */
+std::vector<std::shared_ptr<Land>> makeMixedWorld(size_t count) {
+    auto         lands = makeGridWorld(count);
+    std::mt19937 rng{6};
+    for (size_t i = 0; i < std::max<size_t>(1, count / 1000); ++i) {
+        int const side = std::uniform_int_distribution{2048, 4096}(rng);
+        int const x0   = (1 << 24) + static_cast<int>(i % 10) * 4096;
+        int const z0   = static_cast<int>(i / 10) * 4096;
+        lands.push_back(makeSquare(static_cast<LandID>(lands.size()), x0, z0, side));
+    }
+    return lands;
+}
+
+LandDimensionChunkMap::Options withThreshold(int64_t threshold) {
+    LandDimensionChunkMap::Options options;
+    options.mLargeLandChunkThreshold = threshold;
+    return options;
+}
+
+/**
+ * @brief 与 LandRegistry 的单次写入相同: 复制快照后修改
+ * @return 平均每次写入的毫秒数
+ */
+template <typename Fn>
+double timeWrites(std::shared_ptr<LandIndexSnapshot>& snapshot, int count, Fn&& modify) {
+    return elapsedMs([&] {
+               for (int i = 0; i < count; ++i) {
+                   auto next = std::make_shared<LandIndexSnapshot>(*snapshot);
+                   modify(*next, i);
+                   snapshot = std::move(next);
+               }
+           })
+         / count;
+}
+
+} // namespace
+
+/**
+ * 混合尺寸领地的索引内存与写入耗时: 大型领地单独登记(默认阈值) vs 全部按区块登记(阈值为 0)
+ */
+LD_BENCH_CASE(Bench_LargeLands) {
+    for (size_t count : {1000, 10000, 100000}) {
+        auto const lands = makeMixedWorld(count);
+        auto const large = lands.back();
+
+        for (int64_t threshold : {DefaultThreshold, int64_t{0}}) {
+            auto const live              = AllocationStats::liveBytes();
+            auto       snapshot          = std::make_shared<LandIndexSnapshot>();
+            snapshot->mDimensionChunkMap = LandDimensionChunkMap{withThreshold(threshold)};
+            auto const buildMs           = elapsedMs([&] { addToSnapshot(*snapshot, lands); });
+            auto const memory            = AllocationStats::liveBytes() - live;
+
+            // 大型领地每次向东扩展 16 格
+            auto       grown  = large;
+            auto const growMs = timeWrites(snapshot, 5, [&](LandIndexSnapshot& index, int i) {
+                auto const& box = large->getAABB();
+                grown = makeSquare(large->getId(), box.min.x, box.min.z, box.max.x - box.min.x + 1 + 16 * (i + 1));
+                index.mDimensionChunkMap.refreshRange(grown);
+            });
+
+            // 新增与删除一个 4096 格见方的领地
+            auto const extra = makeSquare(static_cast<LandID>(lands.size()), -(1 << 24), 0, 4096);
+            auto const addMs = timeWrites(snapshot, 1, [&](LandIndexSnapshot& index, int) {
+                index.mLandCache.try_emplace(extra->getId(), extra);
+                index.mDimensionChunkMap.addLand(extra);
+            });
+            auto const removeMs = timeWrites(snapshot, 1, [&](LandIndexSnapshot& index, int) {
+                index.mDimensionChunkMap.removeLand(extra);
+                index.mLandCache.erase(extra->getId());
+            });
+
+            // 大型领地内的坐标点查询
+            std::mt19937          rng{9};
+            std::vector<BlockPos> positions;
+            for (int i = 0; i < 100000; ++i) {
+                positions.push_back(randomPosIn(*large, rng));
+            }
+            auto const lookup = measurePerCall(positions, [&](BlockPos const& pos) {
+                return LandPointQuery::queryAt(*snapshot, pos, 0) != nullptr;
+            });
+
+            logger.info(
+                "领地 {} 个 (大型 {} 个), 阈值 {}: 索引 {:.1f} MB, 建立 {:.1f}ms, 扩展大型领地 {:.3f}ms, "
+                "新增 {:.3f}ms, 删除 {:.3f}ms, 大型领地内点查询 {:.0f}ns",
+                lands.size(),
+                lands.size() - count,
+                threshold,
+                toMB(memory),
+                buildMs,
+                growMs,
+                addMs,
+                removeMs,
+                lookup.mNs
+            );
+        }
+    }
+
+    // 单个领地的索引内存与扩展耗时随面积的变化
+    for (int side : {1024, 4096, 16384}) {
+        for (int64_t threshold : {DefaultThreshold, int64_t{0}}) {
+            auto const land = makeSquare(0, 0, 0, side);
+            auto const live = AllocationStats::liveBytes();
+
+            LandDimensionChunkMap map{withThreshold(threshold)};
+            map.addLand(land);
+            auto const memory = AllocationStats::liveBytes() - live;
+            auto const growMs = elapsedMs([&] { map.refreshRange(makeSquare(0, 0, 0, side + 16)); });
+
+            logger.info(
+                "边长 {} 格 ({} 个区块), 阈值 {}: 索引 {:.1f} KB, 扩展 16 格 {:.3f}ms",
+                side,
+                static_cast<int64_t>(side / 16) * (side / 16),
+                threshold,
+                static_cast<double>(memory) / 1024.0,
+                growMs
+            );
+        }
+    }
+}
+
+} // namespace land::test::bench
@@ -0,0 +1,106 @@
+#include "BenchRunner.h"
+#include "BenchUtil.h"
+
+#include "pland/land/Land.h"
+#include "pland/land/repo/LandContext.h"
+#include "pland/land/repo/internal/LandContextJsonReader.h"
+#include "pland/land/repo/internal/LandDimensionChunkMap.h"
+#include "pland/utils/JsonUtil.h"
+
+#include "ll/api/io/Logger.h"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace land::test::bench {
+
+namespace {
+
+using internal::LandDimensionChunkMap;
+
+constexpr size_t RecordCount  = 50000;
+constexpr size_t MinSliceSize = 256; // 与 LandRegistry::Impl::_sliceCount 相同
+
+/**
+ * @brief 与 LandRegistry::Impl::_parallelFor 相同，当前线程执行第 0 个任务
+ */
+template <typename Fn>
+void parallelFor(size_t count, Fn const& task) {
+    std::vector<std::jthread> threads;
+    for (size_t i = 1; i < count; ++i) {
+        threads.emplace_back([&task, i] { task(i); });
+    }
+    task(0);
+}
+
+} // namespace
+
+/**
+ * 启动加载的并行扩展性: 流式解码 + Land::make 按分组并行，空间索引按分片并行构建后合并
+ * 与 LandRegistry::Impl::_loadLands / _buildDimensionChunkMap 的分组方式相同，线程数为含调用线程在内的总数
+ */
+LD_BENCH_CASE(Bench_ParallelLoad) {
+    std::vector<std::string> source;
+    for (auto const& context : makeContexts(RecordCount)) {
+        source.push_back(json_util::struct2json(context).dump());
+    }
+    logger.info("硬件线程数: {}", std::thread::hardware_concurrency());
+
+    double singleMs = 0;
+    for (size_t threads : {1, 2, 4, 8}) {
+        auto records = source;
+
+        auto const sliceCount = std::clamp<size_t>(records.size() / MinSliceSize, 1, threads);
+        auto const sliceSize  = (records.size() + sliceCount - 1) / sliceCount;
+
+        std::vector<std::vector<std::shared_ptr<Land>>> slices(sliceCount);
+        auto const decodeMs = elapsedMs([&] {
+            parallelFor(sliceCount, [&](size_t i) {
+                auto const first = std::min(records.size(), i * sliceSize);
+                auto const last  = std::min(records.size(), first + sliceSize);
+                for (auto idx = first; idx < last; ++idx) {
+                    auto raw     = std::move(records[idx]);
+                    auto context = LandContext{.mLandName = {}};
+                    if (!internal::LandContextJsonReader::read(raw, context)) {
+                        throw std::runtime_error{"LandContextJsonReader failed"};
+                    }
+                    slices[i].push_back(Land::make(std::move(context)));
+                }
+            });
+        });
+
+        LandDimensionChunkMap map;
+
+        auto const indexMs = elapsedMs([&] {
+            std::vector<LandDimensionChunkMap> shards(sliceCount, LandDimensionChunkMap{map.getOptions()});
+            parallelFor(sliceCount, [&](size_t i) {
+                for (auto const& land : slices[i]) {
+                    shards[i].addLand(land);
+                }
+            });
+            for (auto& shard : shards) {
+                map.merge(std::move(shard));
+            }
+        });
+
+        auto const totalMs = decodeMs + indexMs;
+        if (threads == 1) {
+            singleMs = totalMs;
+        }
+        logger.info(
+            "{} 线程 ({} 组): 解码 {:.0f}ms, 建立索引 {:.0f}ms, 合计 {:.0f}ms (加速比 {:.2f})",
+            threads,
+            sliceCount,
+            decodeMs,
+            indexMs,
+            totalMs,
+            singleMs / totalMs
+        );
+    }
+}
+
+} // namespace land::test::bench
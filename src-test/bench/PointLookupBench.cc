@@ -0,0 +1,127 @@
+#include "BaselineIndex.h"
+#include "BenchRunner.h"
+#include "BenchUtil.h"
+
+#include "pland/land/repo/internal/LandIndexSnapshot.h"
+#include "pland/land/repo/internal/LandPointQuery.h"
+
+#include "ll/api/io/Logger.h"
+
+#include <memory>
+#include <vector>
+
+namespace land::test::bench {
+
+namespace {
+
+using internal::LandIndexSnapshot;
+using internal::LandPointQuery;
+
+constexpr int Positions = 100000;
+
+struct PointWorld {
+    std::vector<std::shared_ptr<Land>> mLands;
+    BaselineIndex                      mBaseline;
+    std::shared_ptr<LandIndexSnapshot> mSnapshot{std::make_shared<LandIndexSnapshot>()};
+    int                                mMinCoord{0}; // 网格覆盖范围 [mMinCoord, mMaxCoord)
+    int                                mMaxCoord{0};
+
+    explicit PointWorld(int cellSize) : mLands(makeGridWorld(50000, 42, cellSize)) {
+        auto subs = makeSubLands(mLands);
+        mLands.insert(mLands.end(), subs.begin(), subs.end());
+        for (auto const& land : mLands) {
+            mBaseline.addLand(land);
+        }
+        addToSnapshot(*mSnapshot, mLands);
+
+        int const side = static_cast<int>(std::ceil(std::sqrt(50000.0)));
+        mMinCoord      = -(side / 2) * cellSize;
+        mMaxCoord      = (side - side / 2) * cellSize;
+    }
+
+    /**
+     * @brief 网格范围内不属于任何领地的随机坐标
+     */
+    [[nodiscard]] BlockPos randomWilderness(std::mt19937& rng) const {
+        std::uniform_int_distribution coord{mMinCoord, mMaxCoord - 1};
+        while (true) {
+            BlockPos pos{coord(rng), 64, coord(rng)};
+            if (!mBaseline.getLandAt(pos, 0)) {
+                return pos;
+            }
+        }
+    }
+
+    [[nodiscard]] PerCall baseline(std::vector<BlockPos> const& positions) const {
+        return measurePerCall(positions, [&](BlockPos const& pos) { return mBaseline.getLandAt(pos, 0) != nullptr; });
+    }
+    [[nodiscard]] PerCall current(std::vector<BlockPos> const& positions) const {
+        return measurePerCall(positions, [&](BlockPos const& pos) {
+            return LandPointQuery::queryAt(*mSnapshot, pos, 0) != nullptr;
+        });
+    }
+};
+
+void logCompare(ll::io::Logger& logger, char const* scene, PerCall const& base, PerCall const& current) {
+    logger.info(
+        "{}: 基线 {:.0f}ns ({:.2f} 次分配), 当前 {:.0f}ns ({:.2f} 次分配)",
+        scene,
+        base.mNs,
+        base.mAllocs,
+        current.mNs,
+        current.mAllocs
+    );
+}
+
+} // namespace
+
+/**
+ * 领地内的坐标点查询: 基线 getLandAt(pos) vs LandPointQuery::queryAt(findLandAt 的实现)
+ */
+LD_BENCH_CASE(Bench_PointLookup) {
+    PointWorld const world{256};
+    std::mt19937     rng{7};
+
+    std::vector<BlockPos> hot, random;
+    for (int i = 0; i < Positions; ++i) {
+        hot.push_back(randomPosIn(*world.mLands[rng() % 16], rng));
+        random.push_back(randomPosIn(*world.mLands[rng() % world.mLands.size()], rng));
+    }
+    logCompare(logger, "领地内，集中在 16 个领地", world.baseline(hot), world.current(hot));
+    logCompare(logger, "领地内，随机领地", world.baseline(random), world.current(random));
+}
+
+/**
+ * 荒野坐标的点查询与区块占用位图的命中情况
+ * 网格边长 256 格时领地密集，1024 格时领地稀疏(领地边长不变)
+ */
+LD_BENCH_CASE(Bench_WildernessLookup) {
+    for (int cellSize : {256, 1024}) {
+        PointWorld const world{cellSize};
+        std::mt19937     rng{11};
+
+        std::vector<BlockPos> wild, mixed, unmarked, marked;
+        for (int i = 0; i < Positions; ++i) {
+            auto const pos = world.randomWilderness(rng);
+            wild.push_back(pos);
+            (world.mSnapshot->mDimensionChunkMap.isChunkMarked(0, pos.x >> 4, pos.z >> 4) ? marked : unmarked)
+                .push_back(pos);
+            mixed.push_back(
+                rng() % 10 == 0 ? randomPosIn(*world.mLands[rng() % world.mLands.size()], rng)
+                                : world.randomWilderness(rng)
+            );
+        }
+
+        logger.info(
+            "网格 {} 格: 荒野坐标中位图未置位(无需查询区块桶) {:.1f}%",
+            cellSize,
+            100.0 * static_cast<double>(unmarked.size()) / static_cast<double>(wild.size())
+        );
+        logCompare(logger, "  全部位于荒野", world.baseline(wild), world.current(wild));
+        logCompare(logger, "  90% 荒野、10% 领地内", world.baseline(mixed), world.current(mixed));
+        logCompare(logger, "  荒野，位图未置位", world.baseline(unmarked), world.current(unmarked));
+        logCompare(logger, "  荒野，位图已置位", world.baseline(marked), world.current(marked));
+    }
+}
+
+} // namespace land::test::bench
@@ -0,0 +1,208 @@
+#include "BaselineIndex.h"
+#include "BenchRunner.h"
+#include "BenchUtil.h"
+
+#include "pland/land/repo/LandContext.h"
+#include "pland/land/repo/internal/LandIndexSnapshot.h"
+#include "pland/land/repo/internal/LandPointQuery.h"
+#include "pland/utils/JsonUtil.h"
+
+#include "ll/api/io/Logger.h"
+
+#include "mc/platform/UUID.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace land::test::bench {
+
+namespace {
+
+using internal::LandIndexSnapshot;
+using internal::LandPointQuery;
+
+constexpr size_t LandCount     = 50000;
+constexpr auto   EventInterval = std::chrono::microseconds{10}; // 服务器线程上的事件间隔(每秒 10 万次)
+constexpr size_t WriteEvery    = 2000;                          // 每 2000 个事件含一次写入(约每 20ms 一次)
+
+/**
+ * @brief 生成带主人、成员与名称的领地(序列化耗时与实际数据相近)
+ */
+std::vector<std::shared_ptr<Land>> makeSaveWorld() {
+    std::mt19937_64 rng{1};
+    auto            lands = makeGridWorld(LandCount);
+    for (size_t i = 0; i < lands.size(); ++i) {
+        auto context       = lands[i]->_getContext();
+        context.mLandOwner = mce::UUID{rng(), rng()}.asString();
+        for (auto m = rng() % 4; m > 0; --m) {
+            context.mLandMembers.push_back(mce::UUID{rng(), rng()}.asString());
+        }
+        context.mLandName = i % 3 == 0 ? "玩家的小屋" : "Unnamed territories";
+        LandTestAccess::reinit(*lands[i], std::move(context));
+    }
+    return lands;
+}
+
+struct LatencyReport {
+    std::vector<double> mSamples; // 每个事件的延迟(微秒)，自计划开始时间起算
+    double              mSaveMs{0};
+    double              mStartMs{0}; // 服务器线程上开始保存的耗时(当前实现为复制待保存数据)
+    double              mStallMs{0}; // 服务器线程上的最长单次事件耗时
+};
+
+/**
+ * @brief 在保存进行期间按固定间隔执行事件，记录每个事件自计划时间起的延迟
+ * 事件落后于计划时不跳过，保存结束后继续处理积压的事件，排队等待的时间计入延迟(避免协同遗漏)
+ * @param startSave 在服务器线程上开始保存，返回保存是否结束的标志
+ * @param event 第 i 个事件
+ */
+template <typename StartSave, typename Event>
+LatencyReport runDuringSave(StartSave&& startSave, Event&& event) {
+    LatencyReport report;
+    auto const    begin = Clock::now();
+    auto const&   done  = startSave();
+    auto          saved = Clock::time_point::max();
+    report.mStartMs     = std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+
+    for (size_t i = 0;; ++i) {
+        auto const planned = begin + EventInterval * static_cast<int64_t>(i);
+        if (saved == Clock::time_point::max() && done.load(std::memory_order_acquire)) {
+            saved = Clock::now();
+        }
+        if (planned >= saved) {
+            break;
+        }
+        while (Clock::now() < planned) {
+            std::this_thread::yield();
+        }
+        auto const start = Clock::now();
+        event(i);
+        auto const end = Clock::now();
+        report.mSamples.push_back(std::chrono::duration<double, std::micro>(end - planned).count());
+        report.mStallMs = std::max(report.mStallMs, std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    report.mSaveMs = std::chrono::duration<double, std::milli>(saved - begin).count();
+    return report;
+}
+
+void log(ll::io::Logger& logger, char const* name, LatencyReport& report) {
+    auto const count = report.mSamples.size();
+    auto const p50   = percentile(report.mSamples, 50);
+    auto const p99   = percentile(report.mSamples, 99);
+    auto const p999  = percentile(report.mSamples, 99.9);
+    auto const max   = percentile(report.mSamples, 100);
+    logger.info(
+        "{}: 保存 {:.0f}ms (开始保存 {:.2f}ms), 事件 {} 个, 延迟 p50 {:.1f}us p99 {:.1f}us p99.9 {:.1f}us 最大 {:.1f}us, "
+        "最长单次事件 {:.2f}ms",
+        name,
+        report.mSaveMs,
+        report.mStartMs,
+        count,
+        p50,
+        p99,
+        p999,
+        max,
+        report.mStallMs
+    );
+}
+
+} // namespace
+
+/**
+ * 保存期间服务器线程的事件延迟(全部领地待保存，JSON 格式)
+ * 基线: 保存任务持有共享锁逐个序列化并写入；坐标查询持有共享锁，领地写入(save(land) 等)需要独占锁，须等待保存结束。
+ * 当前: 服务器线程复制待保存数据后交给后台线程序列化；坐标查询读取快照，写入复制快照后发布，均不等待保存。
+ */
+LD_BENCH_CASE(Bench_EventLatencyDuringSave) {
+    auto const lands = makeSaveWorld();
+
+    std::mt19937          rng{3};
+    std::vector<BlockPos> positions;
+    for (size_t i = 0; i < 1 << 16; ++i) {
+        positions.push_back(randomPosIn(*lands[rng() % lands.size()], rng));
+    }
+    auto const posAt  = [&](size_t i) { return positions[i % positions.size()]; };
+    auto const landAt = [&](size_t i) { return lands[(i * 7919) % lands.size()]; };
+
+    std::vector<std::string> db(lands.size()); // 数据库写入的替身
+
+    {
+        BaselineIndex index;
+        for (auto const& land : lands) {
+            index.addLand(land);
+        }
+
+        std::atomic<bool> done{false};
+        std::thread       saver;
+        auto              report = runDuringSave(
+            [&]() -> std::atomic<bool> const& {
+                saver = std::thread{[&] {
+                    std::shared_lock lock(index.mutex());
+                    for (auto const& land : lands) {
+                        auto context      = land->_getContext();
+                        db[land->getId()] = json_util::struct2json(context).dump();
+                    }
+                    done.store(true, std::memory_order_release);
+                }};
+                return done;
+            },
+            [&](size_t i) {
+                if (i % WriteEvery == WriteEvery - 1) {
+                    index.refreshRange(landAt(i));
+                } else {
+                    keep(index.getLandAt(posAt(i), 0) != nullptr);
+                }
+            }
+        );
+        saver.join();
+        log(logger, "基线", report);
+    }
+
+    {
+        auto snapshot = std::make_shared<LandIndexSnapshot>();
+        addToSnapshot(*snapshot, lands);
+        std::atomic<LandIndexSnapshot const*>           published{snapshot.get()};
+        std::vector<std::shared_ptr<LandIndexSnapshot>> retired; // 旧快照保留到测量结束
+
+        std::atomic<bool> done{false};
+        std::thread       saver;
+        auto              report = runDuringSave(
+            [&]() -> std::atomic<bool> const& {
+                // 与 LandRegistry::Impl::_captureDirty 相同，在服务器线程上复制待保存的数据
+                std::vector<LandContext> captured;
+                captured.reserve(lands.size());
+                for (auto const& land : lands) {
+                    captured.push_back(land->_getContext());
+                }
+                saver = std::thread{[&, captured = std::move(captured)]() mutable {
+                    for (auto& context : captured) {
+                        db[context.mLandID] = json_util::struct2json(context).dump();
+                    }
+                    done.store(true, std::memory_order_release);
+                }};
+                return done;
+            },
+            [&](size_t i) {
+                if (i % WriteEvery == WriteEvery - 1) {
+                    auto next = std::make_shared<LandIndexSnapshot>(*snapshot);
+                    next->mDimensionChunkMap.refreshRange(landAt(i));
+                    ++next->mGeneration;
+                    published.store(next.get(), std::memory_order_release);
+                    retired.push_back(std::exchange(snapshot, std::move(next)));
+                } else {
+                    auto const* index = published.load(std::memory_order_acquire);
+                    keep(LandPointQuery::queryAt(*index, posAt(i), 0) != nullptr);
+                }
+            }
+        );
+        saver.join();
+        log(logger, "当前", report);
+    }
+}
+
+} // namespace land::test::bench
@@ -32,6 +32,10 @@
 #include "DevToolApp.h"
 #endif
 
+#ifdef LD_TEST
+#include "TestRunner.h"
+#endif
+
 namespace land {
 
 
@@ -85,6 +89,13 @@ bool PLand::load() {
     Config::tryLoad();
     internal::interceptor::InterceptorConfig::load(getSelf().getConfigDir());
 
+#ifdef LD_TEST
+    if (test::runAll(logger) != 0) {
+        logger.error("自检用例未全部通过，插件停止加载");
+        return false;
+    }
+#endif
+
     mImpl->mThreadPoolExecutor = std::make_unique<ll::thread::ThreadPoolExecutor>("PLand-ThreadPool", 2);
 
     try {
@@ -191,6 +202,7 @@ SelectorManager*        PLand::getSelectorManager() const { return mImpl->mSelec
 LandRegistry&           PLand::getLandRegistry() const { return *mImpl->mLandRegistry; }
 DrawHandleManager*      PLand::getDrawHandleManager() const { return mImpl->mDrawHandleManager.get(); }
 internal::SafeTeleport& PLand::getSafeTeleport() const { return *mImpl->mSafeTeleport; }
+internal::LandScheduler& PLand::getLandScheduler() const { return *mImpl->mLandScheduler; }
 
 ll::thread::ThreadPoolExecutor& PLand::getThreadPool() const { return *mImpl->mThreadPoolExecutor; }
 service::ServiceLocator&        PLand::getServiceLocator() const { return *mImpl->mServiceLocator; }
@@ -22,7 +22,8 @@ namespace land {
 
 namespace internal {
 class SafeTeleport;
-}
+class LandScheduler;
+} // namespace internal
 
 
 class PLand {
@@ -49,6 +50,8 @@ class PLand {
 
     LDNDAPI internal::SafeTeleport& getSafeTeleport() const;
 
+    LDNDAPI internal::LandScheduler& getLandScheduler() const;
+
 #ifdef LD_DEVTOOL
     void setDevToolVisible(bool visible);
 #endif
@@ -12,7 +12,7 @@ namespace land::gui {
 using namespace ll::form;
 
 void PlayerSettingGUI::sendTo(Player& player) {
-    auto& setting = PLand::getInstance().getLandRegistry().getOrCreatePlayerSettings(player.getUuid());
+    auto setting = PLand::getInstance().getLandRegistry().getPlayerSettings(player.getUuid());
 
     auto       localeCode = player.getLocaleCode();
     CustomForm fm(("[PLand] | 玩家设置"_trl(localeCode)));
@@ -20,13 +20,14 @@ void PlayerSettingGUI::sendTo(Player& player) {
     fm.appendToggle("showEnterLandTitle", "是否显示进入领地提示"_trl(localeCode), setting.showEnterLandTitle);
     fm.appendToggle("showBottomContinuedTip", "是否持续显示底部提示"_trl(localeCode), setting.showBottomContinuedTip);
 
-    fm.sendTo(player, [&setting](Player& pl, CustomFormResult res, FormCancelReason) {
+    fm.sendTo(player, [setting](Player& pl, CustomFormResult res, FormCancelReason) mutable {
         if (!res) {
             return;
         }
 
         setting.showEnterLandTitle     = std::get<uint64_t>(res->at("showEnterLandTitle"));
         setting.showBottomContinuedTip = std::get<uint64_t>(res->at("showBottomContinuedTip"));
+        PLand::getInstance().getLandRegistry().setPlayerSettings(pl.getUuid(), setting);
 
         feedback_utils::sendText(pl, "设置已保存"_trl(pl.getLocaleCode()));
     });
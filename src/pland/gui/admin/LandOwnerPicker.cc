@@ -31,12 +31,12 @@ struct LandOwnerPicker::Impl : std::enable_shared_from_this<Impl> {
     ll::form::SimpleForm::ButtonCallback mBackTo;
 
     void _collectEntries() {
-        auto& info  = ll::service::PlayerInfo::getInstance();
-        auto  lands = PLand::getInstance().getLandRegistry().getLandsByOwner();
-        mEntries.reserve(lands.size());
-        for (auto const& [owner, landSet] : lands) {
+        auto& info   = ll::service::PlayerInfo::getInstance();
+        auto  counts = PLand::getInstance().getLandRegistry().getLandCountByOwner();
+        mEntries.reserve(counts.size());
+        for (auto const& [owner, count] : counts) {
             auto entry = info.fromUuid(owner);
-            mEntries.emplace_back(owner, entry ? entry->name : owner.asString(), landSet.size());
+            mEntries.emplace_back(owner, entry ? entry->name : owner.asString(), count);
         }
     }
 
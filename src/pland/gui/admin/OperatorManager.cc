@@ -70,7 +70,13 @@ void OperatorManager::sendLandSelectModeMenu(Player& player) {
         "浏览全部领地"_trl(localeCode),
         "textures/ui/achievements_pause_menu_icon",
         "path",
-        [](Player& self) { sendAdvancedLandPicker(self, PLand::getInstance().getLandRegistry().getLands()); }
+        [](Player& self) {
+            AdvancedLandPicker::sendToAll(
+                self,
+                [](Player& self, std::shared_ptr<Land> ptr) { LandManagerGUI::sendMainMenu(self, ptr); },
+                back_utils::wrapCallback<sendMainMenu>()
+            );
+        }
     );
     fm.appendButton("按领地 ID 查找"_trl(localeCode), "textures/ui/magnifyingGlass", "path", [](Player& self) {
         sendLandIdSearchForm(self);
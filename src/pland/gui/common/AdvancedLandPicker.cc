@@ -2,8 +2,10 @@
 #include "PaginatedForm.h"
 #include "SimpleInputForm.h"
 #include "pland/Global.h"
+#include "pland/PLand.h"
 #include "pland/gui/utils/BackUtils.h"
 #include "pland/land/Land.h"
+#include "pland/land/repo/LandRegistry.h"
 
 namespace land {
 namespace gui {
@@ -19,16 +21,32 @@ struct AdvancedLandPicker::Impl : std::enable_shared_from_this<Impl> {
         OnlySub,      // 子领地视图
     };
 
+    static constexpr size_t SearchPageSize = 32; // 搜索结果每页数量(与 PaginatedForm 默认值一致)
+
     std::vector<std::shared_ptr<Land>> mData;
     Callback                           mCallback;
     SimpleForm::ButtonCallback         mBackCallback;
     View                               mCurrentView{View::All};
     std::optional<std::string>         mFuzzyKeyword{std::nullopt};
-
-    explicit Impl(std::vector<std::shared_ptr<Land>> data, Callback callback, SimpleForm::ButtonCallback back = {})
+    std::optional<std::vector<LandID>> mScope{std::nullopt}; // 搜索范围(nullopt 表示全部领地)
+
+    explicit Impl(
+        std::vector<std::shared_ptr<Land>> data,
+        bool                               scoped,
+        Callback                           callback,
+        SimpleForm::ButtonCallback         back = {}
+    )
     : mData(std::move(data)),
       mCallback(std::move(callback)),
-      mBackCallback(std::move(back)) {}
+      mBackCallback(std::move(back)) {
+        if (scoped) {
+            auto& scope = mScope.emplace();
+            scope.reserve(mData.size());
+            for (auto const& land : mData) {
+                scope.push_back(land->getId());
+            }
+        }
+    }
 
     std::string getViewName(View view, std::string const& localeCode) {
         switch (view) {
@@ -47,7 +65,8 @@ struct AdvancedLandPicker::Impl : std::enable_shared_from_this<Impl> {
         }
     }
 
-    void _buildActionButton(PaginatedForm& form, View view, std::string const& localeCode) {
+    template <typename Form>
+    void _buildActionButton(Form& form, View view, std::string const& localeCode) {
         form.appendButton(
             getViewName(view, localeCode),
             "textures/ui/store_sort_icon",
@@ -80,7 +99,7 @@ struct AdvancedLandPicker::Impl : std::enable_shared_from_this<Impl> {
         );
     }
 
-    bool canRender(View view, LandType type) {
+    static bool canRender(View view, LandType type) {
         switch (view) {
         case View::OnlyOrdinary:
             return type == LandType::Ordinary;
@@ -96,6 +115,20 @@ struct AdvancedLandPicker::Impl : std::enable_shared_from_this<Impl> {
         }
     }
 
+    template <typename Form>
+    void _appendLandButton(Form& form, std::shared_ptr<Land> const& land, std::string const& localeCode) {
+        form.appendButton(
+            "{}\n维度: {} | ID: {}"_trl(localeCode, land->getName(), land->getDimensionId(), land->getId()),
+            "textures/ui/icon_recipe_nature",
+            "path",
+            [data = shared_from_this(), weak = std::weak_ptr(land)](Player& player) {
+                if (auto land = weak.lock()) {
+                    data->mCallback(player, land);
+                }
+            }
+        );
+    }
+
     void buildView(PaginatedForm& form, View view, std::string const& localeCode) {
         form.setTitle("[PLand] | 领地选择器"_trl(localeCode));
         form.setContent("请选择一个领地"_trl(localeCode));
@@ -105,30 +138,74 @@ struct AdvancedLandPicker::Impl : std::enable_shared_from_this<Impl> {
         _buildActionButton(form, view, localeCode);
 
         for (auto& land : mData) {
-            if (mFuzzyKeyword.has_value() && land->getName().find(mFuzzyKeyword.value()) == std::string::npos) {
-                continue;
-            }
-            if (!canRender(view, land->getType())) {
-                continue;
+            if (canRender(view, land->getType())) {
+                _appendLandButton(form, land, localeCode);
             }
+        }
+    }
+
+    /**
+     * @brief 发送搜索结果的指定页(从 0 开始)
+     * 每页单独向名称索引请求 offset/limit 范围内的结果，视图过滤在索引内完成，页数由匹配总数计算
+     */
+    void sendSearchPage(Player& player, size_t page) {
+        auto  localeCode = player.getLocaleCode();
+        auto& registry   = PLand::getInstance().getLandRegistry();
+
+        auto filter = [view = mCurrentView](std::shared_ptr<Land> const& land) {
+            return canRender(view, land->getType());
+        };
+        auto const offset = page * SearchPageSize;
+        auto const result = mScope ? registry.searchLandsByName(*mScope, *mFuzzyKeyword, offset, SearchPageSize, filter)
+                                   : registry.searchLandsByName(*mFuzzyKeyword, offset, SearchPageSize, filter);
+
+        auto const totalPages = std::max<size_t>(1, (result.mTotal + SearchPageSize - 1) / SearchPageSize);
+        if (page >= totalPages) {
+            sendSearchPage(player, totalPages - 1); // 翻页期间领地被删除，回到最后一页
+            return;
+        }
+
+        SimpleForm form;
+        form.setTitle("[PLand] | 领地选择器"_trl(localeCode));
+        form.setContent(
+            "搜索 \"{}\": 共 {} 个结果，第 {}/{} 页"_trl(localeCode, *mFuzzyKeyword, result.mTotal, page + 1, totalPages)
+        );
+        if (mBackCallback) {
+            back_utils::injectBackButton(form, mBackCallback);
+        }
+        _buildActionButton(form, mCurrentView, localeCode);
+
+        if (page > 0) {
             form.appendButton(
-                "{}\n维度: {} | ID: {}"_trl(localeCode, land->getName(), land->getDimensionId(), land->getId()),
-                "textures/ui/icon_recipe_nature",
+                "上一页"_trl(localeCode),
+                "textures/ui/book_pageleft_default",
                 "path",
-                [data = shared_from_this(), weak = std::weak_ptr(land)](Player& player) {
-                    if (auto land = weak.lock()) {
-                        data->mCallback(player, land);
-                    }
-                }
+                [data = shared_from_this(), page](Player& player) { data->sendSearchPage(player, page - 1); }
             );
         }
+        for (auto const& land : registry.getLands(result.mIds)) {
+            _appendLandButton(form, land, localeCode);
+        }
+        if (page + 1 < totalPages) {
+            form.appendButton(
+                "下一页"_trl(localeCode),
+                "textures/ui/book_pageright_default",
+                "path",
+                [data = shared_from_this(), page](Player& player) { data->sendSearchPage(player, page + 1); }
+            );
+        }
+        form.sendTo(player);
     }
 
     void sendView(Player& player, View view) {
+        mCurrentView = view;
+        if (mFuzzyKeyword) {
+            sendSearchPage(player, 0);
+            return;
+        }
         PaginatedForm form{};
         buildView(form, view, player.getLocaleCode());
         form.sendTo(player);
-        mCurrentView = view;
     }
 
     void nextView(Player& player) {
@@ -149,7 +226,17 @@ void AdvancedLandPicker::sendTo(
     Callback                           callback,
     SimpleForm::ButtonCallback         backTo
 ) {
-    auto impl = std::make_shared<Impl>(std::move(data), std::move(callback), std::move(backTo));
+    auto impl = std::make_shared<Impl>(std::move(data), true, std::move(callback), std::move(backTo));
+    impl->sendTo(player);
+}
+
+void AdvancedLandPicker::sendToAll(Player& player, Callback callback, SimpleForm::ButtonCallback backTo) {
+    auto impl = std::make_shared<Impl>(
+        PLand::getInstance().getLandRegistry().getLands(),
+        false,
+        std::move(callback),
+        std::move(backTo)
+    );
     impl->sendTo(player);
 }
 
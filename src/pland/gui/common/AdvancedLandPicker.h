@@ -15,12 +15,25 @@ class AdvancedLandPicker {
 
 public:
     using Callback = std::function<void(Player&, std::shared_ptr<Land> land)>;
+
+    /**
+     * @brief 从给定领地中选择，搜索仅在 data 范围内进行
+     */
     LDAPI static void sendTo(
         Player&                              player,
         std::vector<std::shared_ptr<Land>>   data,
         Callback                             callback,
         ll::form::SimpleForm::ButtonCallback backTo = nullptr
     );
+
+    /**
+     * @brief 从全部领地中选择，搜索直接分页查询名称索引
+     */
+    LDAPI static void sendToAll(
+        Player&                              player,
+        Callback                             callback,
+        ll::form::SimpleForm::ButtonCallback backTo = nullptr
+    );
 };
 
 } // namespace gui
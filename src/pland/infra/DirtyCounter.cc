@@ -16,5 +16,10 @@ void DirtyCounter::decrement() {
 
 void DirtyCounter::reset(unsigned int val) { mCounter.store(val, std::memory_order_relaxed); }
 
+void DirtyCounter::consume(unsigned int val) {
+    auto current = mCounter.load(std::memory_order_relaxed);
+    while (!mCounter.compare_exchange_weak(current, current > val ? current - val : 0, std::memory_order_relaxed)) {}
+}
+
 
 } // namespace land
\ No newline at end of file
@@ -20,6 +20,8 @@ class DirtyCounter {
     LDAPI void decrement(); // 减少计数器
 
     LDAPI void reset(unsigned int val = 0); // 重置计数器
+
+    LDAPI void consume(unsigned int val); // 扣除已持久化的计数(保留其后新增的修改)
 };
 
 } // namespace land
@@ -2,6 +2,7 @@
 
 #include "Command.h"
 #include "pland/PLand.h"
+#include "pland/internal/interceptor/LandLookupCache.h"
 #include "pland/drawer/DrawHandleManager.h"
 #include "pland/events/domain/ConfigReloadEvent.h"
 #include "pland/gui/LandBuyGUI.h"
@@ -10,6 +11,7 @@
 #include "pland/gui/NewLandGUI.h"
 #include "pland/land/Config.h"
 #include "pland/land/Land.h"
+#include "pland/land/internal/LandScheduler.h"
 #include "pland/land/repo/LandRegistry.h"
 #include "pland/selector/SelectorManager.h"
 #include "pland/service/LandManagementService.h"
@@ -41,8 +43,13 @@
 
 #include <memory>
 #include <sstream>
+#include <string>
 #include <vector>
 
+#ifdef LD_TEST
+#include "bench/BenchRunner.h"
+#endif
+
 
 namespace land::internal {
 
@@ -112,7 +119,7 @@ static auto const Operator = [](CommandOrigin const& ori, CommandOutput& out, Op
 
 static auto const ListOperator = [](CommandOrigin const& ori, CommandOutput& out) {
     CHECK_TYPE(ori, out, CommandOriginType::DedicatedServer);
-    auto& operators = PLand::getInstance().getLandRegistry().getOperators();
+    auto operators = PLand::getInstance().getLandRegistry().getOperators();
     if (operators.empty()) {
         feedback_utils::sendErrorText(out, "当前没有管理员"_tr());
         return;
@@ -208,6 +215,40 @@ static auto const Buy = [](CommandOrigin const& ori, CommandOutput& out) {
     gui::LandBuyGUI::sendTo(player);
 };
 
+static auto const SchedulerStats = [](CommandOrigin const& ori, CommandOutput& out) {
+    CHECK_TYPE(ori, out, CommandOriginType::DedicatedServer);
+    auto stats = PLand::getInstance().getLandScheduler().getCacheStats();
+    feedback_utils::sendText(
+        out,
+        "领地调度缓存: 命中 {} 次, 未命中 {} 次, 命中率 {:.2f}%"_tr(stats.mHits, stats.mMisses, stats.hitRate() * 100)
+    );
+};
+
+static auto const LookupCacheStats = [](CommandOrigin const& ori, CommandOutput& out) {
+    CHECK_TYPE(ori, out, CommandOriginType::DedicatedServer);
+    auto stats = interceptor::LandLookupCache::getStats();
+    feedback_utils::sendText(
+        out,
+        "领地查询缓存: 命中 {} 次, 未命中 {} 次, 命中率 {:.2f}%, 平均每 tick 节省 {:.2f} 次查询"_tr(
+            stats.mHits,
+            stats.mMisses,
+            stats.hitRate() * 100,
+            stats.savedPerTick()
+        )
+    );
+};
+
+#ifdef LD_TEST
+struct BenchParam {
+    std::string name;
+};
+static auto const Bench = [](CommandOrigin const& ori, CommandOutput& out, BenchParam const& param) {
+    CHECK_TYPE(ori, out, CommandOriginType::DedicatedServer);
+    auto count = test::runBenchmarks(PLand::getInstance().getSelf().getLogger(), param.name);
+    feedback_utils::sendText(out, "已运行 {} 个基准，结果见控制台日志", count);
+};
+#endif
+
 static auto const Reload = [](CommandOrigin const& ori, CommandOutput& out) {
     CHECK_TYPE(ori, out, CommandOriginType::DedicatedServer);
     if (Config::tryLoad()) {
@@ -250,9 +291,13 @@ static auto const Draw = [](CommandOrigin const& ori, CommandOutput& out, DrawPa
     }
 
     case DrawType::NearLand: {
-        auto lands = db.getLandAt(player.getPosition(), Config::cfg.land.drawRange, player.getDimensionId().id);
-        for (auto& land : lands) handle->draw(land, mce::Color::WHITE());
-        feedback_utils::sendText(out, "已绘制附近 {} 个领地"_trl(localeCode, lands.size()));
+        size_t count = 0;
+        db.forEachLandIn(player.getPosition(), Config::cfg.land.drawRange, player.getDimensionId().id, [&](auto& land) {
+            handle->draw(land, mce::Color::WHITE());
+            ++count;
+            return true;
+        });
+        feedback_utils::sendText(out, "已绘制附近 {} 个领地"_trl(localeCode, count));
         break;
     }
     }
@@ -310,6 +355,12 @@ bool LandCommand::setup() {
     // pland reload
     cmd.overload().text("reload").execute(Lambda::Reload);
 
+    // pland stats scheduler 领地调度缓存统计
+    cmd.overload().text("stats").text("scheduler").execute(Lambda::SchedulerStats);
+
+    // pland stats lookup_cache 拦截器领地查询缓存统计
+    cmd.overload().text("stats").text("lookup_cache").execute(Lambda::LookupCacheStats);
+
     // pland 领地GUI
     cmd.overload().execute(Lambda::Root);
 
@@ -360,6 +411,11 @@ bool LandCommand::setup() {
     }
 #endif
 
+#ifdef LD_TEST
+    // pland bench [name] 运行名称包含 name 的性能基准(在服务器线程上同步运行，期间服务器暂停响应)
+    cmd.overload<Lambda::BenchParam>().text("bench").optional("name").execute(Lambda::Bench);
+#endif
+
 #ifdef DEBUG
     cmd.overload().text("debug").text("dump_selectors").execute([](CommandOrigin const& ori, CommandOutput&) {
         if (ori.getOriginType() != CommandOriginType::DedicatedServer) {
@@ -1,12 +1,28 @@
 #include "EventInterceptor.h"
+#include "LandLookupCache.h"
+#include "OperatorSession.h"
 
+#include <ll/api/chrono/GameChrono.h>
+#include <ll/api/coro/CoroTask.h>
+#include <ll/api/coro/InterruptableSleep.h>
 #include <ll/api/event/EventBus.h>
+#include <ll/api/event/player/PlayerDisconnectEvent.h>
+#include <ll/api/event/player/PlayerJoinEvent.h>
+#include <ll/api/thread/ServerThreadExecutor.h>
+
+#include <mc/world/actor/player/Player.h>
+
+#include <atomic>
+#include <memory>
 
 namespace land::internal::interceptor {
 
 struct EventInterceptor::Impl {
     std::vector<ll::event::ListenerPtr>      mListeners;
     std::vector<std::unique_ptr<IHookGuard>> mHookGuards;
+
+    std::shared_ptr<std::atomic<bool>>            mQuit{nullptr};      // 协程退出标志
+    std::shared_ptr<ll::coro::InterruptableSleep> mTickSleep{nullptr}; // 查询缓存 tick 等待
 };
 
 EventInterceptor::EventInterceptor() : impl(std::make_unique<Impl>()) {
@@ -17,8 +33,37 @@ EventInterceptor::EventInterceptor() : impl(std::make_unique<Impl>()) {
     setupIlaEntityListeners();
     setupIlaWorldListeners();
     setupHooks();
+
+    // 玩家进入服务器时缓存其操作员身份，特权判断不再查询操作员集合
+    auto& bus = ll::event::EventBus::getInstance();
+    OperatorSession::invalidate();
+    _registerListener(bus.emplaceListener<ll::event::PlayerJoinEvent>([](ll::event::PlayerJoinEvent& ev) {
+        OperatorSession::onJoin(ev.self().getUuid());
+    }));
+    _registerListener(bus.emplaceListener<ll::event::PlayerDisconnectEvent>([](ll::event::PlayerDisconnectEvent& ev) {
+        OperatorSession::onLeave(ev.self().getUuid());
+    }));
+
+    // 每个 tick 推进一次查询缓存纪元，缓存结果仅在当前 tick 内复用
+    impl->mQuit      = std::make_shared<std::atomic<bool>>(false);
+    impl->mTickSleep = std::make_shared<ll::coro::InterruptableSleep>();
+    ll::coro::keepThis([quit = impl->mQuit, sleep = impl->mTickSleep]() -> ll::coro::CoroTask<> {
+        while (!quit->load()) {
+            co_await sleep->sleepFor(ll::chrono::ticks{1});
+            if (quit->load()) {
+                break;
+            }
+            LandLookupCache::advanceTick();
+        }
+        co_return;
+    }).launch(ll::thread::ServerThreadExecutor::getDefault());
 }
 EventInterceptor::~EventInterceptor() {
+    impl->mQuit->store(true);
+    impl->mTickSleep->interrupt(true);
+    LandLookupCache::advanceTick(); // 重新注册监听器后不复用旧结果
+    OperatorSession::invalidate();
+
     auto& bus = ll::event::EventBus::getInstance();
     for (auto& listener : impl->mListeners) {
         bus.removeListener(listener);
@@ -0,0 +1,104 @@
+#include "LandLookupCache.h"
+
+#include "pland/PLand.h"
+#include "pland/land/repo/LandRegistry.h"
+
+#include "mc/world/level/BlockPos.h"
+
+#include "absl/container/inlined_vector.h"
+
+#include <array>
+
+namespace land::internal::interceptor {
+
+namespace {
+
+struct CacheState {
+    std::array<LandLookupCache::Entry, LandLookupCache::Capacity> mSlots{};
+    uint64_t                                                      mTick{1}; // 从 1 开始，零值条目天然失效
+    LandLookupCache::Stats                                        mStats{};
+};
+
+CacheState& state() {
+    static CacheState instance;
+    return instance;
+}
+
+bool matches(LandLookupCache::Entry const& e, uint64_t tick, uint64_t generation, BlockPos const& pos, LandDimid dim) {
+    return e.mTick == tick && e.mGeneration == generation && e.mDimId == dim && e.mX == pos.x && e.mY == pos.y
+        && e.mZ == pos.z;
+}
+
+} // namespace
+
+LandLookupCache::Entry& LandLookupCache::_slot(int x, int y, int z, LandDimid dimId) {
+    auto hash = static_cast<uint32_t>(x) * 73856093u ^ static_cast<uint32_t>(y) * 19349663u
+              ^ static_cast<uint32_t>(z) * 83492791u ^ static_cast<uint32_t>(dimId) * 2654435761u;
+    hash ^= hash >> 16;
+    return state().mSlots[hash & (Capacity - 1)];
+}
+
+Land const* LandLookupCache::find(BlockPos const& pos, LandDimid dimId) {
+    auto& registry   = PLand::getInstance().getLandRegistry();
+    auto& st         = state();
+    auto  generation = registry.getGeneration();
+
+    auto& slot = _slot(pos.x, pos.y, pos.z, dimId);
+    if (matches(slot, st.mTick, generation, pos, dimId)) {
+        ++st.mStats.mHits;
+        return slot.mLand;
+    }
+    ++st.mStats.mMisses;
+
+    auto land = registry.findLandAt(pos, dimId);
+    slot      = {st.mTick, generation, dimId, pos.x, pos.y, pos.z, land};
+    return land;
+}
+
+void LandLookupCache::find(std::span<BlockPos const> positions, LandDimid dimId, std::span<Land const*> out) {
+    auto& registry   = PLand::getInstance().getLandRegistry();
+    auto& st         = state();
+    auto  generation = registry.getGeneration();
+
+    absl::InlinedVector<BlockPos, 8>    missed;
+    absl::InlinedVector<uint32_t, 8>    missedIndex;
+    absl::InlinedVector<Land const*, 8> missedResult;
+    for (uint32_t i = 0; i < positions.size(); ++i) {
+        auto const& pos  = positions[i];
+        auto&       slot = _slot(pos.x, pos.y, pos.z, dimId);
+        if (matches(slot, st.mTick, generation, pos, dimId)) {
+            ++st.mStats.mHits;
+            out[i] = slot.mLand;
+            continue;
+        }
+        ++st.mStats.mMisses;
+        missed.push_back(pos);
+        missedIndex.push_back(i);
+    }
+    if (missed.empty()) {
+        return;
+    }
+
+    // 未命中的坐标合并查询，仍可享受按区块分组的批量优化
+    missedResult.resize(missed.size());
+    registry.findLandsAt(missed, dimId, missedResult);
+    for (size_t i = 0; i < missed.size(); ++i) {
+        out[missedIndex[i]] = missedResult[i];
+
+        auto const& pos                   = missed[i];
+        _slot(pos.x, pos.y, pos.z, dimId) = {st.mTick, generation, dimId, pos.x, pos.y, pos.z, missedResult[i]};
+    }
+}
+
+void LandLookupCache::advanceTick() {
+    auto& st = state();
+    ++st.mTick;
+    ++st.mStats.mTicks;
+}
+
+LandLookupCache::Stats LandLookupCache::getStats() { return state().mStats; }
+
+void LandLookupCache::resetStats() { state().mStats = {}; }
+
+
+} // namespace land::internal::interceptor
@@ -0,0 +1,79 @@
+#pragma once
+#include "pland/Global.h"
+
+#include <cstdint>
+#include <span>
+
+class BlockPos;
+
+namespace land {
+class Land;
+}
+
+namespace land::internal::interceptor {
+
+
+/**
+ * @brief 拦截器领地查询缓存
+ * 同一玩家操作往往触发多个监听器(如交互方块后紧跟使用物品)，红石、流体更新也会在一个 tick 内反复查询同一区块，
+ * 因此以 (维度, 坐标) 为键建立直接映射缓存，缓存条目仅在当前 tick 且领地索引代数未变化时有效。
+ * @warning 仅限服务器线程调用；缓存的指针来自 LandRegistry::findLandAt，遵循同样的借用语义
+ */
+class LandLookupCache final {
+public:
+    inline static constexpr size_t Capacity = 256; // 缓存槽位数量(2 的幂)
+
+    struct Entry {
+        uint64_t    mTick{0};       // 写入时的 tick 纪元
+        uint64_t    mGeneration{0}; // 写入时的索引代数
+        LandDimid   mDimId{-1};     // 维度
+        int         mX{0};          // 坐标 X
+        int         mY{0};          // 坐标 Y
+        int         mZ{0};          // 坐标 Z
+        Land const* mLand{nullptr}; // 查询结果
+    };
+
+    struct Stats {
+        uint64_t mHits{0};   // 命中次数(即节省的查询次数)
+        uint64_t mMisses{0}; // 未命中次数
+        uint64_t mTicks{0};  // 统计期间经过的 tick 数
+
+        [[nodiscard]] double hitRate() const {
+            auto total = mHits + mMisses;
+            return total == 0 ? 0.0 : static_cast<double>(mHits) / static_cast<double>(total);
+        }
+
+        [[nodiscard]] double savedPerTick() const {
+            return mTicks == 0 ? 0.0 : static_cast<double>(mHits) / static_cast<double>(mTicks);
+        }
+    };
+
+    LandLookupCache() = delete;
+
+    /**
+     * @brief 查询坐标所在的领地
+     */
+    [[nodiscard]] static Land const* find(BlockPos const& pos, LandDimid dimId);
+
+    /**
+     * @brief 批量查询坐标所在的领地
+     * @note 未命中的坐标合并为一次 LandRegistry::findLandsAt 查询
+     */
+    static void find(std::span<BlockPos const> positions, LandDimid dimId, std::span<Land const*> out);
+
+    /**
+     * @brief 推进 tick 纪元，使所有缓存条目失效
+     * @note 由拦截器在每个 tick 调用
+     */
+    static void advanceTick();
+
+    [[nodiscard]] static Stats getStats();
+
+    static void resetStats();
+
+private:
+    [[nodiscard]] static Entry& _slot(int x, int y, int z, LandDimid dimId);
+};
+
+
+} // namespace land::internal::interceptor
@@ -0,0 +1,80 @@
+#include "OperatorSession.h"
+
+#include "pland/PLand.h"
+#include "pland/land/repo/LandRegistry.h"
+
+#include "ll/api/service/Bedrock.h"
+
+#include "mc/platform/UUID.h"
+#include "mc/world/actor/player/Player.h"
+#include "mc/world/level/Level.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace land::internal::interceptor {
+
+namespace {
+
+constexpr uint64_t InvalidVersion = std::numeric_limits<uint64_t>::max();
+
+struct SessionState {
+    std::vector<mce::UUID> mOnlineOperators;          // 在线操作员(通常为空或仅有数人，线性查找即可)
+    uint64_t               mVersion{InvalidVersion}; // 建立缓存时的操作员列表版本
+};
+
+SessionState& state() {
+    static SessionState instance;
+    return instance;
+}
+
+/**
+ * @brief 操作员列表版本变化后，按在线玩家重新建立缓存
+ */
+void refresh(SessionState& st, LandRegistry const& registry) {
+    auto const version = registry.getOperatorsVersion();
+    if (st.mVersion == version) {
+        return;
+    }
+    st.mOnlineOperators.clear();
+    if (auto level = ll::service::getLevel()) {
+        level->forEachPlayer([&](Player& player) {
+            if (registry.isOperator(player.getUuid())) {
+                st.mOnlineOperators.push_back(player.getUuid());
+            }
+            return true;
+        });
+    }
+    st.mVersion = version;
+}
+
+} // namespace
+
+bool OperatorSession::isOperator(mce::UUID const& uuid) {
+    auto& st = state();
+    refresh(st, PLand::getInstance().getLandRegistry());
+    return !st.mOnlineOperators.empty() && std::ranges::find(st.mOnlineOperators, uuid) != st.mOnlineOperators.end();
+}
+
+void OperatorSession::onJoin(mce::UUID const& uuid) {
+    auto& st       = state();
+    auto& registry = PLand::getInstance().getLandRegistry();
+    if (st.mVersion != registry.getOperatorsVersion()) {
+        return; // 缓存已过期，下一次查询时重新建立(届时包含该玩家)
+    }
+    if (registry.isOperator(uuid) && std::ranges::find(st.mOnlineOperators, uuid) == st.mOnlineOperators.end()) {
+        st.mOnlineOperators.push_back(uuid);
+    }
+}
+
+void OperatorSession::onLeave(mce::UUID const& uuid) { std::erase(state().mOnlineOperators, uuid); }
+
+void OperatorSession::invalidate() {
+    auto& st = state();
+    st.mOnlineOperators.clear();
+    st.mVersion = InvalidVersion;
+}
+
+
+} // namespace land::internal::interceptor
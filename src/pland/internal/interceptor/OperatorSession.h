@@ -0,0 +1,47 @@
+#pragma once
+#include "pland/Global.h"
+
+#include <cstdint>
+
+namespace mce {
+class UUID;
+}
+
+namespace land::internal::interceptor {
+
+
+/**
+ * @brief 在线玩家操作员身份缓存
+ * 玩家进入服务器时记录其是否为操作员，拦截器判断特权时只需检查在线操作员列表；
+ * 没有在线操作员时(最常见的情况)普通玩家无需任何查询。操作员列表版本变化(添加或移除操作员)后，
+ * 下一次查询按在线玩家重新建立缓存。
+ * @warning 仅限服务器线程调用；只能查询在线玩家
+ */
+class OperatorSession final {
+public:
+    OperatorSession() = delete;
+
+    /**
+     * @brief 查询在线玩家是否为操作员
+     */
+    [[nodiscard]] static bool isOperator(mce::UUID const& uuid);
+
+    /**
+     * @brief 玩家进入服务器
+     */
+    static void onJoin(mce::UUID const& uuid);
+
+    /**
+     * @brief 玩家离开服务器
+     */
+    static void onLeave(mce::UUID const& uuid);
+
+    /**
+     * @brief 丢弃缓存，下一次查询时按在线玩家重新建立
+     * @note 拦截器创建与销毁时调用(重载插件时已有玩家在线)
+     */
+    static void invalidate();
+};
+
+
+} // namespace land::internal::interceptor
@@ -28,12 +28,11 @@
 namespace land::internal::interceptor {
 
 void EventInterceptor::setupIlaEntityListeners() {
-    auto& config   = InterceptorConfig::cfg.listeners;
-    auto  registry = &PLand::getInstance().getLandRegistry();
-    auto  bus      = &ll::event::EventBus::getInstance();
+    auto& config = InterceptorConfig::cfg.listeners;
+    auto  bus    = &ll::event::EventBus::getInstance();
 
-    registerListenerIf(config.ActorDestroyBlockEvent, [bus, registry]() {
-        return bus->emplaceListener<ila::mc::ActorDestroyBlockEvent>([registry](ila::mc::ActorDestroyBlockEvent& ev) {
+    registerListenerIf(config.ActorDestroyBlockEvent, [bus]() {
+        return bus->emplaceListener<ila::mc::ActorDestroyBlockEvent>([](ila::mc::ActorDestroyBlockEvent& ev) {
             TRACE_THIS_EVENT(ila::mc::ActorDestroyBlockEvent);
 
             auto& actor    = ev.self();
@@ -41,15 +40,15 @@ void EventInterceptor::setupIlaEntityListeners() {
 
             TRACE_LOG("actor={}, pos={}", actor.getTypeName(), blockPos.toString());
 
-            auto land = registry->getLandAt(blockPos, actor.getDimensionId());
+            auto land = LandLookupCache::find(blockPos, actor.getDimensionId());
             if (!hasEnvironmentPermission<&EnvironmentPerms::allowMobGrief>(land)) {
                 ev.cancel();
             }
         });
     });
 
-    registerListenerIf(config.MobTakeBlockBeforeEvent, [bus, registry]() {
-        return bus->emplaceListener<ila::mc::MobTakeBlockBeforeEvent>([registry](ila::mc::MobTakeBlockBeforeEvent& ev) {
+    registerListenerIf(config.MobTakeBlockBeforeEvent, [bus]() {
+        return bus->emplaceListener<ila::mc::MobTakeBlockBeforeEvent>([](ila::mc::MobTakeBlockBeforeEvent& ev) {
             TRACE_THIS_EVENT(ila::mc::MobTakeBlockBeforeEvent);
 
             auto& actor    = ev.self();
@@ -57,52 +56,48 @@ void EventInterceptor::setupIlaEntityListeners() {
 
             TRACE_LOG("actor={}, pos={}", actor.getTypeName(), blockPos.toString());
 
-            auto land = registry->getLandAt(blockPos, actor.getDimensionId());
+            auto land = LandLookupCache::find(blockPos, actor.getDimensionId());
             if (!hasEnvironmentPermission<&EnvironmentPerms::allowMobGrief>(land)) {
                 ev.cancel();
             }
         });
     });
 
-    registerListenerIf(config.MobPlaceBlockBeforeEvent, [bus, registry]() {
-        return bus->emplaceListener<ila::mc::MobPlaceBlockBeforeEvent>(
-            [registry](ila::mc::MobPlaceBlockBeforeEvent& ev) {
-                TRACE_THIS_EVENT(ila::mc::MobPlaceBlockBeforeEvent);
+    registerListenerIf(config.MobPlaceBlockBeforeEvent, [bus]() {
+        return bus->emplaceListener<ila::mc::MobPlaceBlockBeforeEvent>([](ila::mc::MobPlaceBlockBeforeEvent& ev) {
+            TRACE_THIS_EVENT(ila::mc::MobPlaceBlockBeforeEvent);
 
-                auto& actor       = ev.self();
-                auto& blockPos    = ev.pos();
-                auto& blockSource = actor.getDimensionBlockSource();
+            auto& actor       = ev.self();
+            auto& blockPos    = ev.pos();
+            auto& blockSource = actor.getDimensionBlockSource();
 
-                TRACE_LOG("actor={}, pos={}", actor.getTypeName(), blockPos.toString());
+            TRACE_LOG("actor={}, pos={}", actor.getTypeName(), blockPos.toString());
 
-                auto land = registry->getLandAt(blockPos, actor.getDimensionId());
-                if (!hasEnvironmentPermission<&EnvironmentPerms::allowMobGrief>(land)) {
-                    ev.cancel();
-                }
+            auto land = LandLookupCache::find(blockPos, actor.getDimensionId());
+            if (!hasEnvironmentPermission<&EnvironmentPerms::allowMobGrief>(land)) {
+                ev.cancel();
             }
-        );
+        });
     });
 
-    registerListenerIf(config.ActorPickupItemBeforeEvent, [bus, registry]() {
-        return bus->emplaceListener<ila::mc::ActorPickupItemBeforeEvent>(
-            [registry](ila::mc::ActorPickupItemBeforeEvent& ev) {
-                TRACE_THIS_EVENT(ila::mc::ActorPickupItemBeforeEvent);
+    registerListenerIf(config.ActorPickupItemBeforeEvent, [bus]() {
+        return bus->emplaceListener<ila::mc::ActorPickupItemBeforeEvent>([](ila::mc::ActorPickupItemBeforeEvent& ev) {
+            TRACE_THIS_EVENT(ila::mc::ActorPickupItemBeforeEvent);
 
-                auto& actor = ev.self();
-                auto& pos   = actor.getPosition();
+            auto& actor = ev.self();
+            auto& pos   = actor.getPosition();
 
-                TRACE_LOG("actor={}, pos={}", actor.getTypeName(), pos.toString());
+            TRACE_LOG("actor={}, pos={}", actor.getTypeName(), pos.toString());
 
-                auto land = registry->getLandAt(pos, actor.getDimensionId());
-                if (!hasEnvironmentPermission<&EnvironmentPerms::allowMobGrief>(land)) {
-                    ev.cancel();
-                }
+            auto land = LandLookupCache::find(pos, actor.getDimensionId());
+            if (!hasEnvironmentPermission<&EnvironmentPerms::allowMobGrief>(land)) {
+                ev.cancel();
             }
-        );
+        });
     });
 
-    registerListenerIf(config.ActorRideBeforeEvent, [bus, registry]() {
-        return bus->emplaceListener<ila::mc::ActorRideBeforeEvent>([registry](ila::mc::ActorRideBeforeEvent& ev) {
+    registerListenerIf(config.ActorRideBeforeEvent, [bus]() {
+        return bus->emplaceListener<ila::mc::ActorRideBeforeEvent>([](ila::mc::ActorRideBeforeEvent& ev) {
             TRACE_THIS_EVENT(ila::mc::ActorRideBeforeEvent);
 
             Actor& passenger = ev.self();
@@ -124,7 +119,7 @@ void EventInterceptor::setupIlaEntityListeners() {
             );
             auto& player = static_cast<Player&>(passenger);
 
-            auto land = registry->getLandAt(target.getPosition(), target.getDimensionId());
+            auto land = LandLookupCache::find(target.getPosition(), target.getDimensionId());
             if (target.hasCategory(ActorCategory::BoatRideable) || target.hasCategory(ActorCategory::MinecartRidable)) {
                 if (hasRolePermission<&RolePerms::allowRideTrans>(land, player.getUuid())) return;
             } else {
@@ -134,45 +129,43 @@ void EventInterceptor::setupIlaEntityListeners() {
         });
     });
 
-    registerListenerIf(config.MobHurtEffectBeforeEvent, [bus, registry]() {
-        return bus->emplaceListener<ila::mc::MobHurtEffectBeforeEvent>(
-            [registry](ila::mc::MobHurtEffectBeforeEvent& ev) {
-                TRACE_THIS_EVENT(ila::mc::MobHurtEffectBeforeEvent);
+    registerListenerIf(config.MobHurtEffectBeforeEvent, [bus]() {
+        return bus->emplaceListener<ila::mc::MobHurtEffectBeforeEvent>([](ila::mc::MobHurtEffectBeforeEvent& ev) {
+            TRACE_THIS_EVENT(ila::mc::MobHurtEffectBeforeEvent);
 
-                auto& actor       = ev.self();
-                auto  sourceActor = ev.source();
+            auto& actor       = ev.self();
+            auto  sourceActor = ev.source();
 
-                if (!sourceActor || !sourceActor->isPlayer()) {
-                    TRACE_LOG("source is not player");
-                    return;
-                }
-                auto& player = static_cast<Player&>(sourceActor.value());
-
-                auto uuid = player.getUuid();
-                auto land = registry->getLandAt(actor.getPosition(), actor.getDimensionId());
-                if (hasPrivilege(land, uuid)) return;
+            if (!sourceActor || !sourceActor->isPlayer()) {
+                TRACE_LOG("source is not player");
+                return;
+            }
+            auto& player = static_cast<Player&>(sourceActor.value());
 
-                if (actor.isPlayer()) {
-                    if (hasMemberOrGuestPermission<&RolePerms::allowPvP>(land, uuid)) return;
-                }
+            auto uuid = player.getUuid();
+            auto land = LandLookupCache::find(actor.getPosition(), actor.getDimensionId());
+            if (hasPrivilege(land, uuid)) return;
 
-                HashedString typeName{actor.getTypeName()};
-                if (InterceptorConfig::cfg.rules.mob.allowFriendlyDamage.contains(typeName)) {
-                    if (hasMemberOrGuestPermission<&RolePerms::allowFriendlyDamage>(land, uuid)) return;
-                } else if (InterceptorConfig::cfg.rules.mob.allowHostileDamage.contains(typeName)) {
-                    if (hasMemberOrGuestPermission<&RolePerms::allowHostileDamage>(land, uuid)) return;
-                } else if (InterceptorConfig::cfg.rules.mob.allowSpecialEntityDamage.contains(typeName)) {
-                    if (hasMemberOrGuestPermission<&RolePerms::allowSpecialEntityDamage>(land, uuid)) return;
-                }
+            if (actor.isPlayer()) {
+                if (hasMemberOrGuestPermission<&RolePerms::allowPvP>(land, uuid)) return;
+            }
 
-                ev.cancel();
+            HashedString typeName{actor.getTypeName()};
+            if (InterceptorConfig::cfg.rules.mob.allowFriendlyDamage.contains(typeName)) {
+                if (hasMemberOrGuestPermission<&RolePerms::allowFriendlyDamage>(land, uuid)) return;
+            } else if (InterceptorConfig::cfg.rules.mob.allowHostileDamage.contains(typeName)) {
+                if (hasMemberOrGuestPermission<&RolePerms::allowHostileDamage>(land, uuid)) return;
+            } else if (InterceptorConfig::cfg.rules.mob.allowSpecialEntityDamage.contains(typeName)) {
+                if (hasMemberOrGuestPermission<&RolePerms::allowSpecialEntityDamage>(land, uuid)) return;
             }
-        );
+
+            ev.cancel();
+        });
     });
 
-    registerListenerIf(config.ActorTriggerPressurePlateBeforeEvent, [bus, registry]() {
+    registerListenerIf(config.ActorTriggerPressurePlateBeforeEvent, [bus]() {
         return bus->emplaceListener<ila::mc::ActorTriggerPressurePlateBeforeEvent>(
-            [registry](ila::mc::ActorTriggerPressurePlateBeforeEvent& ev) {
+            [](ila::mc::ActorTriggerPressurePlateBeforeEvent& ev) {
                 TRACE_THIS_EVENT(ila::mc::ActorTriggerPressurePlateBeforeEvent);
 
                 auto& actor    = ev.self();
@@ -181,7 +174,7 @@ void EventInterceptor::setupIlaEntityListeners() {
 
                 TRACE_LOG("pos={}, isPlayer={}", blockPos.toString(), isPlayer);
 
-                auto land = registry->getLandAt(ev.pos(), actor.getDimensionId());
+                auto land = LandLookupCache::find(ev.pos(), actor.getDimensionId());
                 if (isPlayer) {
                     auto& player = static_cast<Player&>(actor);
                     if (!hasRolePermission<&RolePerms::usePressurePlate>(land, player.getUuid())) {
@@ -15,12 +15,11 @@
 namespace land::internal::interceptor {
 
 void EventInterceptor::setupLLEntityListeners() {
-    auto& config   = InterceptorConfig::cfg.listeners;
-    auto  registry = &PLand::getInstance().getLandRegistry();
-    auto  bus      = &ll::event::EventBus::getInstance();
+    auto& config = InterceptorConfig::cfg.listeners;
+    auto  bus    = &ll::event::EventBus::getInstance();
 
-    registerListenerIf(config.SpawnedMobEvent, [bus, registry]() {
-        return bus->emplaceListener<ll::event::SpawnedMobEvent>([registry](ll::event::SpawnedMobEvent& ev) {
+    registerListenerIf(config.SpawnedMobEvent, [bus]() {
+        return bus->emplaceListener<ll::event::SpawnedMobEvent>([](ll::event::SpawnedMobEvent& ev) {
             TRACE_THIS_EVENT(ll::event::SpawnedMobEvent);
 
             auto mob = ev.mob();
@@ -37,7 +36,7 @@ void EventInterceptor::setupLLEntityListeners() {
                 mob ? mob->getTypeName() : "null"
             );
 
-            auto land = registry->getLandAt(pos, mob->getDimensionId());
+            auto land = LandLookupCache::find(pos, mob->getDimensionId());
 
             bool allowMonster = hasEnvironmentPermission<&EnvironmentPerms::allowMonsterSpawn>(land);
             bool allowAnimal  = hasEnvironmentPermission<&EnvironmentPerms::allowAnimalSpawn>(land);
@@ -49,8 +48,8 @@ void EventInterceptor::setupLLEntityListeners() {
         });
     });
 
-    registerListenerIf(config.ActorHurtEvent, [bus, registry]() {
-        return bus->emplaceListener<ll::event::ActorHurtEvent>([registry](ll::event::ActorHurtEvent& ev) {
+    registerListenerIf(config.ActorHurtEvent, [bus]() {
+        return bus->emplaceListener<ll::event::ActorHurtEvent>([](ll::event::ActorHurtEvent& ev) {
             TRACE_THIS_EVENT(ll::event::ActorHurtEvent);
 
             auto& actor  = ev.self();
@@ -67,7 +66,7 @@ void EventInterceptor::setupLLEntityListeners() {
             }
 
             auto& uuid = player->getUuid();
-            auto  land = registry->getLandAt(actor.getPosition(), actor.getDimensionId());
+            auto  land = LandLookupCache::find(actor.getPosition(), actor.getDimensionId());
             if (hasPrivilege(land, uuid)) return;
 
             if (actor.isPlayer()) {
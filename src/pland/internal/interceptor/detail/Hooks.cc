@@ -71,8 +71,7 @@ LL_TYPE_INSTANCE_HOOK(
     auto& pos   = hookActor.getPosition();
     auto  dimId = hookActor.getDimensionId();
 
-    auto& db   = PLand::getInstance().getLandRegistry();
-    auto  land = db.getLandAt(pos, dimId);
+    auto land = LandLookupCache::find(pos, dimId);
     if (!hasRolePermission<&RolePerms::allowFishingRodAndHook>(land, player->getUuid())) {
         return;
     }
@@ -90,8 +89,7 @@ LL_TYPE_INSTANCE_HOOK(
     ::BlockSource&    region,
     ::BlockPos const& pos
 ) {
-    auto& db   = PLand::getInstance().getLandRegistry();
-    auto  land = db.getLandAt(pos, region.getDimensionId());
+    auto land = LandLookupCache::find(pos, region.getDimensionId());
     if (!hasEnvironmentPermission<&EnvironmentPerms::allowMobGrief>(land)) {
         return false; // 如果领地内不允许实体破坏，则阻止产蛋
     }
@@ -112,8 +110,7 @@ LL_TYPE_INSTANCE_HOOK(
     int               age,
     ::BlockPos const& firePos
 ) {
-    auto& db   = PLand::getInstance().getLandRegistry();
-    auto  land = db.getLandAt(pos, region.getDimensionId());
+    auto land = LandLookupCache::find(pos, region.getDimensionId());
     if (!hasEnvironmentPermission<&EnvironmentPerms::allowFireSpread>(land)) {
         return; // 如果领地内不允许火焰蔓延，则阻止蔓延
     }
@@ -134,8 +131,7 @@ LL_TYPE_INSTANCE_HOOK(
         origin(actor);
         return;
     }
-    auto& db   = PLand::getInstance().getLandRegistry();
-    auto  land = db.getLandAt(this->mPosition, actor.getDimensionId());
+    auto land = LandLookupCache::find(this->mPosition, actor.getDimensionId());
     if (!hasGuestPermission<&RolePerms::useContainer>(land)) {
         return; // 访客权限不允许，拦截铜傀儡开箱子
     }
@@ -150,8 +146,7 @@ LL_TYPE_INSTANCE_HOOK(
     &LightningBolt::$normalTick,
     void
 ) {
-    auto& registry = PLand::getInstance().getLandRegistry();
-    if (auto land = registry.getLandAt(this->getPosition(), this->getDimensionId())) {
+    if (auto land = LandLookupCache::find(this->getPosition(), this->getDimensionId())) {
         if (!hasEnvironmentPermission<&EnvironmentPerms::allowLightningBolt>(land)) {
             this->remove(); // 必须标记移除，否则闪电实体不会被移除且会一直tick
             return;         // 不允许闪电，拦截 tick
@@ -172,8 +167,7 @@ LL_TYPE_INSTANCE_HOOK(
     auto& player = event.mPlayer;
     auto& pos    = event.mPos;
 
-    auto& registry = PLand::getInstance().getLandRegistry();
-    auto  land     = registry.getLandAt(pos, player.getDimensionId());
+    auto land = LandLookupCache::find(pos, player.getDimensionId());
     if (!hasRolePermission<&RolePerms::useLectern>(land, player.getUuid())) {
         return; // 拦截阅读/放置书本
     }
@@ -188,8 +182,7 @@ LL_TYPE_INSTANCE_HOOK(
     Player&         player,
     BlockPos const& pos
 ) {
-    auto& registry = PLand::getInstance().getLandRegistry();
-    auto  land     = registry.getLandAt(pos, player.getDimensionId());
+    auto land = LandLookupCache::find(pos, player.getDimensionId());
     if (!hasRolePermission<&RolePerms::useLectern>(land, player.getUuid())) {
         return false; // 拦截取下书本
     }
@@ -207,9 +200,8 @@ LL_TYPE_INSTANCE_HOOK(
     int      amplifier
 ) {
     // Wiki: 此效果的生物死亡时，会尝试在死亡处生成2只中型史莱姆
-    auto& pos      = actor.getPosition();
-    auto& registry = PLand::getInstance().getLandRegistry();
-    auto  land     = registry.getLandAt(pos, actor.getDimensionId());
+    auto& pos  = actor.getPosition();
+    auto  land = LandLookupCache::find(pos, actor.getDimensionId());
     if (!hasEnvironmentPermission<&EnvironmentPerms::allowMonsterSpawn>(land)) {
         return;
     }
@@ -225,9 +217,8 @@ LL_TYPE_INSTANCE_HOOK(
     int      amplifier
 ) {
     // Wiki: 当游戏规则mobGriefing为true时，拥有盘丝的生物死亡后会在以自身为中心3×3×3的范围内尝试生成2-3个蜘蛛网
-    auto& pos      = actor.getPosition();
-    auto& registry = PLand::getInstance().getLandRegistry();
-    auto  land     = registry.getLandAt(pos, actor.getDimensionId());
+    auto& pos  = actor.getPosition();
+    auto  land = LandLookupCache::find(pos, actor.getDimensionId());
     if (!hasEnvironmentPermission<&EnvironmentPerms::allowMobGrief>(land)) {
         return;
     }
@@ -248,8 +239,7 @@ LL_TYPE_INSTANCE_HOOK(
         return origin(owner);
     }
 
-    auto& registry = PLand::getInstance().getLandRegistry();
-    auto  land     = registry.getLandAt(owner.getPosition(), owner.getDimensionId());
+    auto land = LandLookupCache::find(owner.getPosition(), owner.getDimensionId());
     if (!hasGuestPermission<&RolePerms::useContainer>(land)) {
         return false;
     }
@@ -18,13 +18,12 @@
 namespace land::internal::interceptor {
 
 void EventInterceptor::setupIlaPlayerListeners() {
-    auto& config   = InterceptorConfig::cfg.listeners;
-    auto  registry = &PLand::getInstance().getLandRegistry();
-    auto  bus      = &ll::event::EventBus::getInstance();
+    auto& config = InterceptorConfig::cfg.listeners;
+    auto  bus    = &ll::event::EventBus::getInstance();
 
-    registerListenerIf(config.PlayerInteractEntityBeforeEvent, [bus, registry]() {
+    registerListenerIf(config.PlayerInteractEntityBeforeEvent, [bus]() {
         return bus->emplaceListener<ila::mc::PlayerInteractEntityBeforeEvent>(
-            [registry](ila::mc::PlayerInteractEntityBeforeEvent& ev) {
+            [](ila::mc::PlayerInteractEntityBeforeEvent& ev) {
                 TRACE_THIS_EVENT(ila::mc::PlayerInteractEntityBeforeEvent);
 
                 auto& player = ev.self();
@@ -32,7 +31,7 @@ void EventInterceptor::setupIlaPlayerListeners() {
 
                 TRACE_LOG("player={}, target={}", player.getRealName(), target.getTypeName());
 
-                auto land = registry->getLandAt(target.getPosition(), target.getDimensionId());
+                auto land = LandLookupCache::find(target.getPosition(), target.getDimensionId());
                 if (!hasRolePermission<&RolePerms::allowInteractEntity>(land, player.getUuid())) {
                     ev.cancel();
                 }
@@ -40,9 +39,9 @@ void EventInterceptor::setupIlaPlayerListeners() {
         );
     });
 
-    registerListenerIf(config.ArmorStandSwapItemBeforeEvent, [bus, registry]() {
+    registerListenerIf(config.ArmorStandSwapItemBeforeEvent, [bus]() {
         return bus->emplaceListener<ila::mc::ArmorStandSwapItemBeforeEvent>(
-            [registry](ila::mc::ArmorStandSwapItemBeforeEvent& ev) {
+            [](ila::mc::ArmorStandSwapItemBeforeEvent& ev) {
                 TRACE_THIS_EVENT(ila::mc::ArmorStandSwapItemBeforeEvent);
 
                 auto&    player     = ev.player();
@@ -51,7 +50,7 @@ void EventInterceptor::setupIlaPlayerListeners() {
 
                 TRACE_LOG("player={}, armorStandPos={}", player.getRealName(), pos.toString());
 
-                auto land = registry->getLandAt(armorStand.getPosition(), armorStand.getDimensionId());
+                auto land = LandLookupCache::find(armorStand.getPosition(), armorStand.getDimensionId());
                 if (!hasRolePermission<&RolePerms::useArmorStand>(land, player.getUuid())) {
                     ev.cancel();
                 }
@@ -59,26 +58,24 @@ void EventInterceptor::setupIlaPlayerListeners() {
         );
     });
 
-    registerListenerIf(config.PlayerDropItemBeforeEvent, [bus, registry]() {
-        return bus->emplaceListener<ila::mc::PlayerDropItemBeforeEvent>(
-            [registry](ila::mc::PlayerDropItemBeforeEvent& ev) {
-                TRACE_THIS_EVENT(ila::mc::PlayerDropItemBeforeEvent);
+    registerListenerIf(config.PlayerDropItemBeforeEvent, [bus]() {
+        return bus->emplaceListener<ila::mc::PlayerDropItemBeforeEvent>([](ila::mc::PlayerDropItemBeforeEvent& ev) {
+            TRACE_THIS_EVENT(ila::mc::PlayerDropItemBeforeEvent);
 
-                auto& player = ev.self();
+            auto& player = ev.self();
 
-                TRACE_LOG("player={}", player.getRealName());
+            TRACE_LOG("player={}", player.getRealName());
 
-                auto land = registry->getLandAt(player.getPosition(), player.getDimensionId());
-                if (!hasRolePermission<&RolePerms::allowDropItem>(land, player.getUuid())) {
-                    ev.cancel();
-                }
+            auto land = LandLookupCache::find(player.getPosition(), player.getDimensionId());
+            if (!hasRolePermission<&RolePerms::allowDropItem>(land, player.getUuid())) {
+                ev.cancel();
             }
-        );
+        });
     });
 
-    registerListenerIf(config.PlayerOperatedItemFrameBeforeEvent, [bus, registry]() {
+    registerListenerIf(config.PlayerOperatedItemFrameBeforeEvent, [bus]() {
         return bus->emplaceListener<ila::mc::PlayerOperatedItemFrameBeforeEvent>(
-            [registry](ila::mc::PlayerOperatedItemFrameBeforeEvent& ev) {
+            [](ila::mc::PlayerOperatedItemFrameBeforeEvent& ev) {
                 TRACE_THIS_EVENT(ila::mc::PlayerOperatedItemFrameBeforeEvent);
 
                 auto& player = ev.self();
@@ -86,7 +83,7 @@ void EventInterceptor::setupIlaPlayerListeners() {
 
                 TRACE_LOG("player={}, pos={}", player.getRealName(), pos.toString());
 
-                auto land = registry->getLandAt(ev.blockPos(), player.getDimensionId());
+                auto land = LandLookupCache::find(ev.blockPos(), player.getDimensionId());
                 if (!hasRolePermission<&RolePerms::useItemFrame>(land, player.getUuid())) {
                     ev.cancel();
                 }
@@ -94,22 +91,20 @@ void EventInterceptor::setupIlaPlayerListeners() {
         );
     });
 
-    registerListenerIf(config.PlayerEditSignBeforeEvent, [bus, registry]() {
-        return bus->emplaceListener<ila::mc::PlayerEditSignBeforeEvent>(
-            [registry](ila::mc::PlayerEditSignBeforeEvent& ev) {
-                TRACE_THIS_EVENT(ila::mc::PlayerEditSignBeforeEvent);
+    registerListenerIf(config.PlayerEditSignBeforeEvent, [bus]() {
+        return bus->emplaceListener<ila::mc::PlayerEditSignBeforeEvent>([](ila::mc::PlayerEditSignBeforeEvent& ev) {
+            TRACE_THIS_EVENT(ila::mc::PlayerEditSignBeforeEvent);
 
-                auto& player = ev.self();
-                auto& pos    = ev.pos();
+            auto& player = ev.self();
+            auto& pos    = ev.pos();
 
-                TRACE_LOG("player={}, pos={}", player.getRealName(), pos.toString());
+            TRACE_LOG("player={}, pos={}", player.getRealName(), pos.toString());
 
-                auto land = registry->getLandAt(pos, player.getDimensionId());
-                if (!hasRolePermission<&RolePerms::editSign>(land, player.getUuid())) {
-                    ev.cancel();
-                }
+            auto land = LandLookupCache::find(pos, player.getDimensionId());
+            if (!hasRolePermission<&RolePerms::editSign>(land, player.getUuid())) {
+                ev.cancel();
             }
-        );
+        });
     });
 }
 
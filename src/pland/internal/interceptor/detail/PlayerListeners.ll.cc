@@ -35,124 +35,117 @@
 namespace land::internal::interceptor {
 
 void EventInterceptor::setupLLPlayerListeners() {
-    auto& config   = InterceptorConfig::cfg.listeners;
-    auto  registry = &PLand::getInstance().getLandRegistry();
-    auto  bus      = &ll::event::EventBus::getInstance();
+    auto& config = InterceptorConfig::cfg.listeners;
+    auto  bus    = &ll::event::EventBus::getInstance();
 
-    registerListenerIf(config.PlayerDestroyBlockEvent, [bus, registry]() {
-        return bus->emplaceListener<ll::event::PlayerDestroyBlockEvent>(
-            [registry](ll::event::PlayerDestroyBlockEvent& ev) {
-                TRACE_THIS_EVENT(ll::event::PlayerDestroyBlockEvent);
+    registerListenerIf(config.PlayerDestroyBlockEvent, [bus]() {
+        return bus->emplaceListener<ll::event::PlayerDestroyBlockEvent>([](ll::event::PlayerDestroyBlockEvent& ev) {
+            TRACE_THIS_EVENT(ll::event::PlayerDestroyBlockEvent);
 
-                auto& player = ev.self();
-                auto& pos    = ev.pos();
-                TRACE_LOG("player={}, pos={}", player.getRealName(), pos.toString());
+            auto& player = ev.self();
+            auto& pos    = ev.pos();
+            TRACE_LOG("player={}, pos={}", player.getRealName(), pos.toString());
 
-                auto land = registry->getLandAt(pos, player.getDimensionId());
-                if (!hasRolePermission<&RolePerms::allowDestroy>(land, player.getUuid())) {
-                    ev.cancel();
-                }
+            auto land = LandLookupCache::find(pos, player.getDimensionId());
+            if (!hasRolePermission<&RolePerms::allowDestroy>(land, player.getUuid())) {
+                ev.cancel();
             }
-        );
+        });
     });
 
-    registerListenerIf(config.PlayerPlacingBlockEvent, [bus, registry]() {
-        return bus->emplaceListener<ll::event::PlayerPlacingBlockEvent>(
-            [registry](ll::event::PlayerPlacingBlockEvent& ev) {
-                TRACE_THIS_EVENT(ll::event::PlayerPlacingBlockEvent);
+    registerListenerIf(config.PlayerPlacingBlockEvent, [bus]() {
+        return bus->emplaceListener<ll::event::PlayerPlacingBlockEvent>([](ll::event::PlayerPlacingBlockEvent& ev) {
+            TRACE_THIS_EVENT(ll::event::PlayerPlacingBlockEvent);
 
-                auto& player = ev.self();
-                auto  pos    = ev.pos().relative(ev.face(), 1);
-                TRACE_LOG("player={}, pos={}", player.getRealName(), pos.toString());
+            auto& player = ev.self();
+            auto  pos    = ev.pos().relative(ev.face(), 1);
+            TRACE_LOG("player={}, pos={}", player.getRealName(), pos.toString());
 
-                auto land = registry->getLandAt(pos, player.getDimensionId());
-                if (!hasRolePermission<&RolePerms::allowPlace>(land, player.getUuid())) {
-                    ev.cancel();
-                }
+            auto land = LandLookupCache::find(pos, player.getDimensionId());
+            if (!hasRolePermission<&RolePerms::allowPlace>(land, player.getUuid())) {
+                ev.cancel();
             }
-        );
+        });
     });
 
 
-    registerListenerIf(config.PlayerInteractBlockEvent, [bus, registry]() {
-        return bus->emplaceListener<ll::event::PlayerInteractBlockEvent>(
-            [registry](ll::event::PlayerInteractBlockEvent& ev) {
-                TRACE_THIS_EVENT(ll::event::PlayerInteractBlockEvent);
-
-                auto& player = ev.self();
-                auto& uuid   = player.getUuid();
-                auto& pos    = ev.blockPos();
-
-                TRACE_LOG("player={}, pos={}, item={}", player.getRealName(), pos.toString(), ev.item().getTypeName());
-
-                auto land = registry->getLandAt(pos, player.getDimensionId());
-                if (hasPrivilege(land, uuid)) return;
-
-                if (auto item = ev.item().getItem()) {
-                    void** vftable = *reinterpret_cast<void** const*>(item);
-                    if (vftable == BucketItem::$vftable()) {
-                        if (hasMemberOrGuestPermission<&RolePerms::useBucket>(land, uuid)) return;
-                    } else if (vftable == HatchetItem::$vftable()) {
-                        if (hasMemberOrGuestPermission<&RolePerms::useAxe>(land, uuid)) return;
-                    } else if (vftable == HoeItem::$vftable()) {
-                        if (hasMemberOrGuestPermission<&RolePerms::useHoe>(land, uuid)) return;
-                    } else if (vftable == ShovelItem::$vftable()) {
-                        if (hasMemberOrGuestPermission<&RolePerms::useShovel>(land, uuid)) return;
-                    } else if (item->hasTag(VanillaItemTags::Boats) || item->hasTag(VanillaItemTags::Boat)) {
-                        if (hasMemberOrGuestPermission<&RolePerms::placeBoat>(land, uuid)) return;
-                    } else if (item->hasTag(VanillaItemTags::Minecart)) {
-                        if (hasMemberOrGuestPermission<&RolePerms::placeMinecart>(land, uuid)) return;
-                    } else if (vftable == FlintAndSteelItem::$vftable()) {
-                        if (hasMemberOrGuestPermission<&RolePerms::useFlintAndSteel>(land, uuid)) return;
-                    }
-                    // fallback
-                    if (auto pointer = InterceptorConfig::lookupDynamicRule(ev.item().getTypeName())) {
-                        if (_hasMemberOrGuestPermission(land, uuid, pointer)) {
-                            return;
-                        }
-                    }
+    registerListenerIf(config.PlayerInteractBlockEvent, [bus]() {
+        return bus->emplaceListener<ll::event::PlayerInteractBlockEvent>([](ll::event::PlayerInteractBlockEvent& ev) {
+            TRACE_THIS_EVENT(ll::event::PlayerInteractBlockEvent);
+
+            auto& player = ev.self();
+            auto& uuid   = player.getUuid();
+            auto& pos    = ev.blockPos();
+
+            TRACE_LOG("player={}, pos={}, item={}", player.getRealName(), pos.toString(), ev.item().getTypeName());
+
+            auto land = LandLookupCache::find(pos, player.getDimensionId());
+            if (hasPrivilege(land, uuid)) return;
+
+            if (auto item = ev.item().getItem()) {
+                void** vftable = *reinterpret_cast<void** const*>(item);
+                if (vftable == BucketItem::$vftable()) {
+                    if (hasMemberOrGuestPermission<&RolePerms::useBucket>(land, uuid)) return;
+                } else if (vftable == HatchetItem::$vftable()) {
+                    if (hasMemberOrGuestPermission<&RolePerms::useAxe>(land, uuid)) return;
+                } else if (vftable == HoeItem::$vftable()) {
+                    if (hasMemberOrGuestPermission<&RolePerms::useHoe>(land, uuid)) return;
+                } else if (vftable == ShovelItem::$vftable()) {
+                    if (hasMemberOrGuestPermission<&RolePerms::useShovel>(land, uuid)) return;
+                } else if (item->hasTag(VanillaItemTags::Boats) || item->hasTag(VanillaItemTags::Boat)) {
+                    if (hasMemberOrGuestPermission<&RolePerms::placeBoat>(land, uuid)) return;
+                } else if (item->hasTag(VanillaItemTags::Minecart)) {
+                    if (hasMemberOrGuestPermission<&RolePerms::placeMinecart>(land, uuid)) return;
+                } else if (vftable == FlintAndSteelItem::$vftable()) {
+                    if (hasMemberOrGuestPermission<&RolePerms::useFlintAndSteel>(land, uuid)) return;
                 }
-                if (auto block = ev.block()) {
-                    auto&  legacyBlock = block->getBlockType();
-                    void** vftable     = *reinterpret_cast<void** const*>(&legacyBlock);
-                    if (legacyBlock.isButtonBlock()) {
-                        if (hasMemberOrGuestPermission<&RolePerms::useButton>(land, uuid)) return;
-                    } else if (legacyBlock.isDoorBlock()) {
-                        if (hasMemberOrGuestPermission<&RolePerms::useDoor>(land, uuid)) return;
-                    } else if (legacyBlock.isFenceGateBlock()) {
-                        if (hasMemberOrGuestPermission<&RolePerms::useFenceGate>(land, uuid)) return;
-                    } else if (legacyBlock.isFenceBlock()) {
-                        if (hasMemberOrGuestPermission<&RolePerms::allowInteractEntity>(land, uuid)) return;
-                    } else if (legacyBlock.mIsTrapdoor) {
-                        if (hasMemberOrGuestPermission<&RolePerms::useTrapdoor>(land, uuid)) return;
-                    } else if (vftable == ShulkerBoxBlock::$vftable()) {
-                        if (hasMemberOrGuestPermission<&RolePerms::useContainer>(land, uuid)) return;
-                    } else if (legacyBlock.isCraftingBlock()) {
-                        if (hasMemberOrGuestPermission<&RolePerms::useWorkstation>(land, uuid)) return;
-                    } else if (legacyBlock.isLeverBlock()) {
-                        if (hasMemberOrGuestPermission<&RolePerms::useLever>(land, uuid)) return;
-                    } else if (vftable == BlastFurnaceBlock::$vftable() || vftable == FurnaceBlock::$vftable()
-                               || vftable == SmokerBlock::$vftable()) {
-                        if (hasMemberOrGuestPermission<&RolePerms::useFurnaces>(land, uuid)) return;
-                    } else if (vftable == BeaconBlock::$vftable()) {
-                        if (hasMemberOrGuestPermission<&RolePerms::useBeacon>(land, uuid)) return;
-                    } else if (vftable == BedBlock::$vftable()) {
-                        if (hasMemberOrGuestPermission<&RolePerms::useBed>(land, uuid)) return;
+                // fallback
+                if (auto pointer = InterceptorConfig::lookupDynamicRule(ev.item().getTypeName())) {
+                    if (_hasMemberOrGuestPermission(land, uuid, pointer)) {
+                        return;
                     }
-                    // fallback
-                    if (auto pointer = InterceptorConfig::lookupDynamicRule(block->getTypeName().data())) {
-                        if (_hasMemberOrGuestPermission(land, uuid, pointer)) {
-                            return;
-                        }
+                }
+            }
+            if (auto block = ev.block()) {
+                auto&  legacyBlock = block->getBlockType();
+                void** vftable     = *reinterpret_cast<void** const*>(&legacyBlock);
+                if (legacyBlock.isButtonBlock()) {
+                    if (hasMemberOrGuestPermission<&RolePerms::useButton>(land, uuid)) return;
+                } else if (legacyBlock.isDoorBlock()) {
+                    if (hasMemberOrGuestPermission<&RolePerms::useDoor>(land, uuid)) return;
+                } else if (legacyBlock.isFenceGateBlock()) {
+                    if (hasMemberOrGuestPermission<&RolePerms::useFenceGate>(land, uuid)) return;
+                } else if (legacyBlock.isFenceBlock()) {
+                    if (hasMemberOrGuestPermission<&RolePerms::allowInteractEntity>(land, uuid)) return;
+                } else if (legacyBlock.mIsTrapdoor) {
+                    if (hasMemberOrGuestPermission<&RolePerms::useTrapdoor>(land, uuid)) return;
+                } else if (vftable == ShulkerBoxBlock::$vftable()) {
+                    if (hasMemberOrGuestPermission<&RolePerms::useContainer>(land, uuid)) return;
+                } else if (legacyBlock.isCraftingBlock()) {
+                    if (hasMemberOrGuestPermission<&RolePerms::useWorkstation>(land, uuid)) return;
+                } else if (legacyBlock.isLeverBlock()) {
+                    if (hasMemberOrGuestPermission<&RolePerms::useLever>(land, uuid)) return;
+                } else if (vftable == BlastFurnaceBlock::$vftable() || vftable == FurnaceBlock::$vftable()
+                           || vftable == SmokerBlock::$vftable()) {
+                    if (hasMemberOrGuestPermission<&RolePerms::useFurnaces>(land, uuid)) return;
+                } else if (vftable == BeaconBlock::$vftable()) {
+                    if (hasMemberOrGuestPermission<&RolePerms::useBeacon>(land, uuid)) return;
+                } else if (vftable == BedBlock::$vftable()) {
+                    if (hasMemberOrGuestPermission<&RolePerms::useBed>(land, uuid)) return;
+                }
+                // fallback
+                if (auto pointer = InterceptorConfig::lookupDynamicRule(block->getTypeName().data())) {
+                    if (_hasMemberOrGuestPermission(land, uuid, pointer)) {
+                        return;
                     }
                 }
-                ev.cancel();
             }
-        );
+            ev.cancel();
+        });
     });
 
-    registerListenerIf(config.PlayerAttackEvent, [bus, registry]() {
-        return bus->emplaceListener<ll::event::PlayerAttackEvent>([registry](ll::event::PlayerAttackEvent& ev) {
+    registerListenerIf(config.PlayerAttackEvent, [bus]() {
+        return bus->emplaceListener<ll::event::PlayerAttackEvent>([](ll::event::PlayerAttackEvent& ev) {
             TRACE_THIS_EVENT(ll::event::PlayerAttackEvent);
 
             auto&    player = ev.self();
@@ -162,7 +155,7 @@ void EventInterceptor::setupLLPlayerListeners() {
 
             TRACE_LOG("player={}, target={}, pos={}", player.getRealName(), target.getTypeName(), pos.toString());
 
-            auto land = registry->getLandAt(pos, player.getDimensionId());
+            auto land = LandLookupCache::find(pos, player.getDimensionId());
             if (hasPrivilege(land, uuid)) return;
 
             if (target.isPlayer()) {
@@ -181,8 +174,8 @@ void EventInterceptor::setupLLPlayerListeners() {
             ev.cancel();
         });
     });
-    registerListenerIf(config.PlayerPickUpItemEvent, [bus, registry]() {
-        return bus->emplaceListener<ll::event::PlayerPickUpItemEvent>([registry](ll::event::PlayerPickUpItemEvent& ev) {
+    registerListenerIf(config.PlayerPickUpItemEvent, [bus]() {
+        return bus->emplaceListener<ll::event::PlayerPickUpItemEvent>([](ll::event::PlayerPickUpItemEvent& ev) {
             TRACE_THIS_EVENT(ll::event::PlayerPickUpItemEvent);
 
             auto&    player = ev.self();
@@ -191,15 +184,15 @@ void EventInterceptor::setupLLPlayerListeners() {
 
             TRACE_LOG("player={}, item={}, pos={}", player.getRealName(), item.getTypeName(), pos.toString());
 
-            auto land = registry->getLandAt(pos, player.getDimensionId());
+            auto land = LandLookupCache::find(pos, player.getDimensionId());
             if (!hasRolePermission<&RolePerms::allowPlayerPickupItem>(land, player.getUuid())) {
                 ev.cancel();
             }
         });
     });
 
-    registerListenerIf(config.PlayerUseItemEvent, [bus, registry]() {
-        return bus->emplaceListener<ll::event::PlayerUseItemEvent>([registry](ll::event::PlayerUseItemEvent& ev) {
+    registerListenerIf(config.PlayerUseItemEvent, [bus]() {
+        return bus->emplaceListener<ll::event::PlayerUseItemEvent>([](ll::event::PlayerUseItemEvent& ev) {
             TRACE_THIS_EVENT(ll::event::PlayerUseItemEvent);
 
             auto& player    = ev.self();
@@ -212,7 +205,7 @@ void EventInterceptor::setupLLPlayerListeners() {
 
             TRACE_LOG("item={}, throwable={}", itemStack.getTypeName(), item->isThrowable());
 
-            auto land = registry->getLandAt(player.getPosition(), player.getDimensionId());
+            auto land = LandLookupCache::find(player.getPosition(), player.getDimensionId());
             if (hasPrivilege(land, player.getUuid())) return;
 
             if (item->isThrowable()) {
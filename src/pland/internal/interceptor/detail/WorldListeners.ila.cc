@@ -23,6 +23,8 @@
 #include "mc/world/level/Explosion.h"
 #include "mc/world/phys/AABB.h"
 
+#include <array>
+
 namespace land::internal::interceptor {
 
 void EventInterceptor::setupIlaWorldListeners() {
@@ -42,64 +44,69 @@ void EventInterceptor::setupIlaWorldListeners() {
 
             TRACE_LOG("centerPos={}, radius={}", centerPos.toString(), radius);
 
-            auto centerLand = registry->getLandAt(centerPos, dimid);
+            auto centerLand = LandLookupCache::find(centerPos, dimid);
             if (!hasEnvironmentPermission<&EnvironmentPerms::allowExplode>(centerLand)) {
                 ev.cancel();
                 TRACE_LOG("center land does not allow explode");
                 return; // 爆炸中心所在领地的权限具有决定性
             }
 
-            auto touchedLands = registry->getLandAt(centerPos, (int)(radius + 1.0), dimid);
             if (centerLand) {
                 // 如果中心领地允许爆炸，检查是否影响到其他禁止爆炸的、不相关的领地。
                 auto& service    = PLand::getInstance().getServiceLocator().getLandHierarchyService();
-                auto  centerRoot = service.getRoot(centerLand);
-                for (auto const& touchedLand : touchedLands) {
-                    if (service.getRoot(touchedLand) != centerRoot) {
-                        if (!hasEnvironmentPermission<&EnvironmentPerms::allowExplode>(touchedLand)) {
-                            TRACE_LOG("touched land does not allow explode");
-                            ev.cancel();
-                            return;
-                        }
+                auto  centerRoot = service.getRoot(registry->getLand(centerLand->getId()));
+                registry->forEachLandIn(centerPos, (int)(radius + 1.0), dimid, [&](auto const& touchedLand) {
+                    if (service.getRoot(touchedLand) != centerRoot
+                        && !hasEnvironmentPermission<&EnvironmentPerms::allowExplode>(touchedLand.get())) {
+                        TRACE_LOG("touched land does not allow explode");
+                        ev.cancel();
+                        return false;
                     }
-                }
+                    return true;
+                });
             } else {
                 // 情况：爆炸发生在领地外。
                 // 如果影响到任何禁止爆炸的领地，则取消。
-                for (auto const& touchedLand : touchedLands) {
-                    if (!hasEnvironmentPermission<&EnvironmentPerms::allowExplode>(touchedLand)) {
+                registry->forEachLandIn(centerPos, (int)(radius + 1.0), dimid, [&](auto const& touchedLand) {
+                    if (!hasEnvironmentPermission<&EnvironmentPerms::allowExplode>(touchedLand.get())) {
                         TRACE_LOG("external land does not allow explode");
                         ev.cancel();
-                        return;
+                        return false;
                     }
-                }
+                    return true;
+                });
             }
         });
     });
 
-    registerListenerIf(config.FarmDecayBeforeEvent, [bus, registry]() {
-        return bus->emplaceListener<ila::mc::FarmDecayBeforeEvent>([registry](ila::mc::FarmDecayBeforeEvent& ev) {
+    registerListenerIf(config.FarmDecayBeforeEvent, [bus]() {
+        return bus->emplaceListener<ila::mc::FarmDecayBeforeEvent>([](ila::mc::FarmDecayBeforeEvent& ev) {
             TRACE_THIS_EVENT(ila::mc::FarmDecayBeforeEvent);
 
             auto& blockPos = ev.pos();
 
             TRACE_LOG("pos={}", blockPos.toString());
 
-            auto land = registry->getLandAt(blockPos, ev.blockSource().getDimensionId());
+            auto land = LandLookupCache::find(blockPos, ev.blockSource().getDimensionId());
             if (!hasEnvironmentPermission<&EnvironmentPerms::allowFarmDecay>(land)) {
                 ev.cancel();
             }
         });
     });
 
-    registerListenerIf(config.PistonPushBeforeEvent, [bus, registry]() {
-        return bus->emplaceListener<ila::mc::PistonPushBeforeEvent>([registry](ila::mc::PistonPushBeforeEvent& ev) {
+    registerListenerIf(config.PistonPushBeforeEvent, [bus]() {
+        return bus->emplaceListener<ila::mc::PistonPushBeforeEvent>([](ila::mc::PistonPushBeforeEvent& ev) {
             auto& pistonPos = ev.pistonPos();
             auto& pushPos   = ev.pushPos();
 
-            auto dimid      = ev.blockSource().getDimensionId();
-            auto pistonLand = registry->getLandAt(pistonPos, dimid);
-            auto pushLand   = registry->getLandAt(pushPos, dimid);
+            auto dimid = ev.blockSource().getDimensionId();
+
+            // 活塞与被推动方块通常位于同一区块，批量查询可复用区块桶
+            BlockPos const             positions[2]{pistonPos, pushPos};
+            std::array<Land const*, 2> lands{};
+            LandLookupCache::find(positions, dimid, lands);
+            auto pistonLand = lands[0];
+            auto pushLand   = lands[1];
 
             // 由于活塞事件复杂，需要处理4种可能的情况
             // 内 => 内 / 外 => 内 / 内 => 外 / 外 => 外
@@ -130,26 +137,24 @@ void EventInterceptor::setupIlaWorldListeners() {
         });
     });
 
-    registerListenerIf(config.RedstoneUpdateBeforeEvent, [bus, registry]() {
-        return bus->emplaceListener<ila::mc::RedstoneUpdateBeforeEvent>(
-            [registry](ila::mc::RedstoneUpdateBeforeEvent& ev) {
-                auto& blockSource = ev.blockSource();
-                auto& blockPos    = ev.pos();
+    registerListenerIf(config.RedstoneUpdateBeforeEvent, [bus]() {
+        return bus->emplaceListener<ila::mc::RedstoneUpdateBeforeEvent>([](ila::mc::RedstoneUpdateBeforeEvent& ev) {
+            auto& blockSource = ev.blockSource();
+            auto& blockPos    = ev.pos();
 
-                auto land = registry->getLandAt(blockPos, blockSource.getDimensionId());
-                if (!hasEnvironmentPermission<&EnvironmentPerms::allowRedstoneUpdate>(land)) {
-                    ev.cancel();
-                }
+            auto land = LandLookupCache::find(blockPos, blockSource.getDimensionId());
+            if (!hasEnvironmentPermission<&EnvironmentPerms::allowRedstoneUpdate>(land)) {
+                ev.cancel();
             }
-        );
+        });
     });
 
-    registerListenerIf(config.BlockFallBeforeEvent, [bus, registry]() {
-        return bus->emplaceListener<ila::mc::BlockFallBeforeEvent>([registry](ila::mc::BlockFallBeforeEvent& ev) {
+    registerListenerIf(config.BlockFallBeforeEvent, [bus]() {
+        return bus->emplaceListener<ila::mc::BlockFallBeforeEvent>([](ila::mc::BlockFallBeforeEvent& ev) {
             auto& blockSource = ev.blockSource();
             auto& blockPos    = ev.pos();
 
-            auto land = registry->getLandAt(blockPos, blockSource.getDimensionId());
+            auto land = LandLookupCache::find(blockPos, blockSource.getDimensionId());
             if (land && land->getAABB().isAboveLand(blockPos)
                 && !hasEnvironmentPermission<&EnvironmentPerms::allowBlockFall>(land)) {
                 ev.cancel();
@@ -171,7 +176,7 @@ void EventInterceptor::setupIlaWorldListeners() {
                 auto lands =
                     registry->getLandAt(aabb.min - Offset, aabb.max + Offset, ev.blockSource().getDimensionId());
                 for (auto const& p : lands) {
-                    if (!hasEnvironmentPermission<&EnvironmentPerms::allowWitherDestroy>(p)) {
+                    if (!hasEnvironmentPermission<&EnvironmentPerms::allowWitherDestroy>(p.get())) {
                         ev.cancel();
                         break;
                     }
@@ -192,7 +197,7 @@ void EventInterceptor::setupIlaWorldListeners() {
 
             auto lds = registry->getLandAt(minPos, maxPos, blockSource.getDimensionId());
             for (auto const& land : lds) {
-                if (!hasEnvironmentPermission<&EnvironmentPerms::allowMossGrowth>(land)) {
+                if (!hasEnvironmentPermission<&EnvironmentPerms::allowMossGrowth>(land.get())) {
                     ev.cancel();
                     return;
                 }
@@ -200,13 +205,13 @@ void EventInterceptor::setupIlaWorldListeners() {
         });
     });
 
-    registerListenerIf(config.LiquidFlowBeforeEvent, [bus, registry]() {
-        return bus->emplaceListener<ila::mc::LiquidFlowBeforeEvent>([registry](ila::mc::LiquidFlowBeforeEvent& ev) {
+    registerListenerIf(config.LiquidFlowBeforeEvent, [bus]() {
+        return bus->emplaceListener<ila::mc::LiquidFlowBeforeEvent>([](ila::mc::LiquidFlowBeforeEvent& ev) {
             auto& blockSource = ev.blockSource();
             auto& fromPos     = ev.flowFromPos(); // 源头 (水流来的方向)
             auto& toPos       = ev.pos();         // 目标 (水流要去的地方)
 
-            auto landTo = registry->getLandAt(toPos, blockSource.getDimensionId());
+            auto landTo = LandLookupCache::find(toPos, blockSource.getDimensionId());
             if (landTo && !hasEnvironmentPermission<&EnvironmentPerms::allowLiquidFlow>(landTo)
                 && landTo->getAABB().isOnOuterBoundary(fromPos) && landTo->getAABB().isOnInnerBoundary(toPos)) {
                 ev.cancel();
@@ -214,13 +219,13 @@ void EventInterceptor::setupIlaWorldListeners() {
         });
     });
 
-    registerListenerIf(config.DragonEggBlockTeleportBeforeEvent, [bus, registry]() {
+    registerListenerIf(config.DragonEggBlockTeleportBeforeEvent, [bus]() {
         return bus->emplaceListener<ila::mc::DragonEggBlockTeleportBeforeEvent>(
-            [registry](ila::mc::DragonEggBlockTeleportBeforeEvent& ev) {
+            [](ila::mc::DragonEggBlockTeleportBeforeEvent& ev) {
                 auto& blockSource = ev.blockSource();
                 auto& blockPos    = ev.pos();
 
-                auto land = registry->getLandAt(blockPos, blockSource.getDimensionId());
+                auto land = LandLookupCache::find(blockPos, blockSource.getDimensionId());
                 if (!hasEnvironmentPermission<&EnvironmentPerms::allowDragonEggTeleport>(land)) {
                     ev.cancel();
                 }
@@ -228,28 +233,29 @@ void EventInterceptor::setupIlaWorldListeners() {
         );
     });
 
-    registerListenerIf(config.SculkBlockGrowthBeforeEvent, [bus, registry]() {
-        return bus->emplaceListener<ila::mc::SculkBlockGrowthBeforeEvent>(
-            [registry](ila::mc::SculkBlockGrowthBeforeEvent& ev) {
-                auto& blockSource = ev.blockSource();
-                auto& blockPos    = ev.pos();
+    registerListenerIf(config.SculkBlockGrowthBeforeEvent, [bus]() {
+        return bus->emplaceListener<ila::mc::SculkBlockGrowthBeforeEvent>([](ila::mc::SculkBlockGrowthBeforeEvent& ev) {
+            auto& blockSource = ev.blockSource();
+            auto& blockPos    = ev.pos();
 
-                auto land = registry->getLandAt(blockPos, blockSource.getDimensionId());
-                if (!hasEnvironmentPermission<&EnvironmentPerms::allowSculkBlockGrowth>(land)) {
-                    ev.cancel();
-                }
+            auto land = LandLookupCache::find(blockPos, blockSource.getDimensionId());
+            if (!hasEnvironmentPermission<&EnvironmentPerms::allowSculkBlockGrowth>(land)) {
+                ev.cancel();
             }
-        );
+        });
     });
 
-    registerListenerIf(config.SculkSpreadBeforeEvent, [bus, registry]() {
-        return bus->emplaceListener<ila::mc::SculkSpreadBeforeEvent>([registry](ila::mc::SculkSpreadBeforeEvent& ev) {
+    registerListenerIf(config.SculkSpreadBeforeEvent, [bus]() {
+        return bus->emplaceListener<ila::mc::SculkSpreadBeforeEvent>([](ila::mc::SculkSpreadBeforeEvent& ev) {
             auto& blockSource = ev.blockSource();
             auto& fromPos     = ev.selfPos();
             auto& toPos       = ev.targetPos();
 
-            auto sou = registry->getLandAt(fromPos, blockSource.getDimensionId());
-            auto tar = registry->getLandAt(toPos, blockSource.getDimensionId());
+            BlockPos const             positions[2]{fromPos, toPos};
+            std::array<Land const*, 2> lands{};
+            LandLookupCache::find(positions, blockSource.getDimensionId(), lands);
+            auto sou = lands[0];
+            auto tar = lands[1];
 
             if (!hasEnvironmentPermission<&EnvironmentPerms::allowSculkSpread>(sou)
                 || !hasEnvironmentPermission<&EnvironmentPerms::allowSculkSpread>(tar)) {
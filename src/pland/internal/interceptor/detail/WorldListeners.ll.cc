@@ -10,15 +10,14 @@
 namespace land::internal::interceptor {
 
 void EventInterceptor::setupLLWorldListeners() {
-    auto& config   = InterceptorConfig::cfg.listeners;
-    auto  registry = &PLand::getInstance().getLandRegistry();
-    auto  bus      = &ll::event::EventBus::getInstance();
+    auto& config = InterceptorConfig::cfg.listeners;
+    auto  bus    = &ll::event::EventBus::getInstance();
 
-    registerListenerIf(config.FireSpreadEvent, [bus, registry]() {
-        return bus->emplaceListener<ll::event::FireSpreadEvent>([registry](ll::event::FireSpreadEvent& ev) {
+    registerListenerIf(config.FireSpreadEvent, [bus]() {
+        return bus->emplaceListener<ll::event::FireSpreadEvent>([](ll::event::FireSpreadEvent& ev) {
             auto& pos = ev.pos();
 
-            auto land = registry->getLandAt(pos, ev.blockSource().getDimensionId());
+            auto land = LandLookupCache::find(pos, ev.blockSource().getDimensionId());
             if (!hasEnvironmentPermission<&EnvironmentPerms::allowFireSpread>(land)) {
                 ev.cancel();
             }
@@ -5,6 +5,8 @@
 #include "pland/reflect/TypeName.h"
 
 #include "EventTrace.h"
+#include "pland/internal/interceptor/LandLookupCache.h"
+#include "pland/internal/interceptor/OperatorSession.h"
 
 #include <memory>
 
@@ -13,15 +15,15 @@ namespace land::internal::interceptor {
 /**
  * 检查玩家是否拥有特权
  * @param land 领地
- * @param uuid 玩家UUID
+ * @param uuid 在线玩家UUID
  * @return 是否拥有特权
  */
-inline bool hasPrivilege(std::shared_ptr<Land> const& land, mce::UUID const& uuid) {
+inline bool hasPrivilege(Land const* land, mce::UUID const& uuid) {
     TRACE_ADD_SCOPE("hasPrivilege");
     TRACE_LOG("land={}", land ? land->getName() : "nullptr");
     if (!land) return true; // 领地不存在 => 放行
-    bool isOperator = PLand::getInstance().getLandRegistry().isOperator(uuid);
     bool isOwner    = land->isOwner(uuid);
+    bool isOperator = !isOwner && OperatorSession::isOperator(uuid); // 主人无需再查询
     TRACE_LOG("isOperator={}, isOwner={}", isOperator, isOwner);
     return isOperator || isOwner;
 }
@@ -33,7 +35,7 @@ inline bool hasPrivilege(std::shared_ptr<Land> const& land, mce::UUID const& uui
  * @return 是否有权限
  */
 template <bool EnvironmentPerms::* Member>
-inline bool hasEnvironmentPermission(std::shared_ptr<Land> const& land) {
+inline bool hasEnvironmentPermission(Land const* land) {
     TRACE_ADD_SCOPE(reflect::extractFunctionSignature(__FUNCSIG__));
     TRACE_LOG("land={}", land ? land->getName() : "nullptr");
     if (!land) return true; // 领地不存在 => 放行
@@ -46,7 +48,7 @@ inline bool hasEnvironmentPermission(std::shared_ptr<Land> const& land) {
  * 检查玩家成员访客权限
  */
 template <RolePerms::Entry RolePerms::* Member>
-inline bool hasMemberOrGuestPermission(std::shared_ptr<Land> const& land, mce::UUID const& uuid) {
+inline bool hasMemberOrGuestPermission(Land const* land, mce::UUID const& uuid) {
     TRACE_ADD_SCOPE(reflect::extractFunctionSignature(__FUNCSIG__));
     TRACE_LOG("land={}", land ? land->getName() : "nullptr");
     if (!land) return true; // 领地不存在 => 放行
@@ -60,8 +62,8 @@ inline bool hasMemberOrGuestPermission(std::shared_ptr<Land> const& land, mce::U
     return entry.guest;
 }
 inline bool _hasMemberOrGuestPermission(
-    std::shared_ptr<Land> const& land,
-    mce::UUID const&             uuid,
+    Land const*                   land,
+    mce::UUID const&              uuid,
     RolePerms::Entry RolePerms::* pointer
 ) {
     assert(pointer);
@@ -87,7 +89,7 @@ inline bool _hasMemberOrGuestPermission(
  * @return 是否有权限
  */
 template <RolePerms::Entry RolePerms::* Member>
-inline bool hasRolePermission(std::shared_ptr<Land> const& land, mce::UUID const& uuid) {
+inline bool hasRolePermission(Land const* land, mce::UUID const& uuid) {
     TRACE_ADD_SCOPE(reflect::extractFunctionSignature(__FUNCSIG__));
     if (hasPrivilege(land, uuid)) return true;             // 领地不存在 / 管理员 / 主人 => 放行
     return hasMemberOrGuestPermission<Member>(land, uuid); // 成员 / 访客
@@ -102,7 +104,7 @@ inline bool hasRolePermission(std::shared_ptr<Land> const& land, mce::UUID const
  * @note 现有权限模型下铜傀儡不是有效的角色类型, 权限也无法划分为环境类权限
  */
 template <RolePerms::Entry RolePerms::* Member>
-inline bool hasGuestPermission(std::shared_ptr<Land> const& land) {
+inline bool hasGuestPermission(Land const* land) {
     TRACE_ADD_SCOPE(reflect::extractFunctionSignature(__FUNCSIG__));
     TRACE_LOG("land={}", land ? land->getName() : "nullptr");
     if (!land) return true; // 领地不存在 => 放行
@@ -91,6 +91,23 @@ struct Config {
         std::string alias{"木棍"};           // 别名
     } selector;
 
+    struct {
+        bool ySection{true};                // 3D 领地按 16 格高度分段索引(减少叠层领地的候选数量)
+        int  largeLandChunkThreshold{4096}; // 超过该区块数量的领地不按区块登记(<=0 禁用)
+        bool mortonOrder{false};            // 区块索引使用 Morton(Z序) 有序存储(重启生效，用于与哈希索引对比)
+        bool persistSnapshot{true};         // 正常关闭时持久化空间索引，下次启动数据未变化时跳过重建
+    } spatialIndex; // 空间索引
+
+    struct {
+        bool enabled{true};    // 记录领地变更日志，异常退出后启动时重放，避免丢失两次自动保存之间的修改
+        int  groupCommitMs{5}; // 日志批量提交间隔(毫秒)，间隔内的变更合并为一次磁盘同步
+    } journal; // 变更日志
+
+    struct {
+        bool binaryFormat{false};  // 领地数据以紧凑二进制格式写入数据库(读取时自动识别格式，开启后旧版本插件无法读取)
+        bool lazyColdFields{true}; // 领地成员名单在首次访问时才展开，降低长期不活跃领地的常驻内存
+    } storage; // 存储
+
     struct {
         bool telemetry{true}; // 遥测（匿名数据统计）
         bool devTools{false}; // 开发工具
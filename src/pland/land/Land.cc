@@ -5,9 +5,15 @@
 #include "pland/Global.h"
 #include "pland/PLand.h"
 #include "pland/land/Config.h"
+#include "pland/land/repo/LandRegistry.h"
+#include "pland/land/repo/internal/LandContextCodec.h"
 #include "pland/utils/JsonUtil.h"
 #include "repo/LandContext.h"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
 #include <unordered_set>
 #include <vector>
 
@@ -21,24 +27,87 @@ struct Land::Impl {
     // cache
     mutable std::optional<mce::UUID>      mCacheOwner;
     mutable std::unordered_set<mce::UUID> mCacheMembers;
+    std::vector<mce::UUID>                mMemberIds; // 有序的成员 UUID(常驻，成员判断无需展开冷字段)
     mutable std::optional<int>            mCacheNestedLevel;
 
+    // 冷字段(成员名单及成员缓存)，领地对外可见前压缩一次，首次访问时展开，此后不再压缩
+    std::string       mColdData;    // 冷字段的紧凑编码
+    std::atomic<bool> mCold{false}; // 冷字段是否尚未展开
+    std::mutex        mColdMutex;   // 展开锁
+
+    Impl() = default;
+    explicit Impl(LandContext context) : mContext(std::move(context)) {}
+
     void initCache() {
         mCacheOwner = std::nullopt;
-        mCacheMembers.clear();
-
         if (!mContext.mOwnerDataIsXUID) {
             mCacheOwner = mce::UUID::fromString(mContext.mLandOwner);
         }
+        initMemberCache();
+        initMemberIds();
+    }
+    // 展开时只重建成员缓存；mMemberIds 内容不变，不得在此修改(其它线程可能正在读取)
+    void initMemberCache() {
+        mCacheMembers.clear();
         mCacheMembers.reserve(mContext.mLandMembers.size());
         for (auto const& member : mContext.mLandMembers) {
             mCacheMembers.emplace(mce::UUID::fromString(member));
         }
     }
+    void initMemberIds() {
+        mMemberIds.assign(mCacheMembers.begin(), mCacheMembers.end());
+        std::sort(mMemberIds.begin(), mMemberIds.end(), memberLess);
+        mMemberIds.shrink_to_fit();
+    }
+    static bool memberLess(mce::UUID const& lhs, mce::UUID const& rhs) {
+        return lhs.a != rhs.a ? lhs.a < rhs.a : lhs.b < rhs.b;
+    }
+
+    /**
+     * @brief 展开冷字段
+     * @note 可在任意线程调用；展开完成前其它线程会等待
+     */
+    void hydrate() {
+        if (!mCold.load(std::memory_order_acquire)) [[likely]] {
+            return;
+        }
+        std::lock_guard guard(mColdMutex);
+        if (!mCold.load(std::memory_order_relaxed)) {
+            return;
+        }
+        if (!internal::LandContextCodec::decode(mColdData, mContext)) {
+            throw std::runtime_error("Failed to hydrate land data");
+        }
+        std::string{}.swap(mColdData);
+        initMemberCache();
+        mCold.store(false, std::memory_order_release);
+    }
+    /**
+     * @brief 压缩冷字段
+     * @warning 仅可在领地对外可见前调用：读取已展开的冷字段不加锁，压缩会与之竞争
+     */
+    void compact() {
+        if (mCold.load(std::memory_order_relaxed)) {
+            return;
+        }
+        mColdData = internal::LandContextCodec::encode(mContext, internal::LandContextCodec::Cold);
+        std::vector<std::string>{}.swap(mContext.mLandMembers);
+        std::unordered_set<mce::UUID>{}.swap(mCacheMembers);
+        mCold.store(true, std::memory_order_release);
+    }
+    [[nodiscard]] bool hasMemberId(mce::UUID const& uuid) const {
+        return std::binary_search(mMemberIds.begin(), mMemberIds.end(), uuid, memberLess);
+    }
+    // 即将整体替换 mContext，丢弃尚未展开的冷字段
+    void dropCold() {
+        std::lock_guard guard(mColdMutex);
+        std::string{}.swap(mColdData);
+        mCold.store(false, std::memory_order_release);
+    }
 };
 
 Land::Land() : impl(std::make_unique<Impl>()) {}
-Land::Land(LandContext ctx) : Land{} { impl->mContext = std::move(ctx); }
+Land::Land(LandContext ctx) : impl(std::make_unique<Impl>(std::move(ctx))) { impl->initCache(); }
 Land::Land(LandAABB const& pos, LandDimid dimid, bool is3D, mce::UUID const& owner, LandPermTable ptable) : Land{} {
     impl->mContext.mPos           = pos;
     impl->mContext.mLandDimid     = dimid;
@@ -57,6 +126,7 @@ bool           Land::setTeleportPos(LandPos const& pos) {
     if (getAABB().hasPos(pos.as<>())) {
         impl->mContext.mTeleportPos = pos;
         impl->mDirtyCounter.increment();
+        _journal(LandMutation::TeleportPos);
         return true;
     }
     return false;
@@ -69,6 +139,7 @@ LandPermTable const& Land::getPermTable() const { return impl->mContext.mLandPer
 void                 Land::setPermTable(LandPermTable permTable) {
     impl->mContext.mLandPermTable = permTable;
     impl->mDirtyCounter.increment();
+    _journal(LandMutation::PermTable);
 }
 
 mce::UUID const& Land::getOwner() const {
@@ -84,36 +155,53 @@ void Land::setOwner(mce::UUID const& uuid) {
     impl->mCacheOwner         = uuid;
     impl->mContext.mLandOwner = uuid.asString();
     impl->mDirtyCounter.increment();
+    _syncIndexes();
+    _journal(LandMutation::Owner, impl->mContext.mLandOwner);
 }
 std::string const& Land::getRawOwner() const { return impl->mContext.mLandOwner; }
 
-std::unordered_set<mce::UUID> const& Land::getMembers() const { return impl->mCacheMembers; }
-void                                 Land::addLandMember(mce::UUID const& uuid) {
+std::unordered_set<mce::UUID> const& Land::getMembers() const {
+    impl->hydrate();
+    return impl->mCacheMembers;
+}
+void Land::addLandMember(mce::UUID const& uuid) {
+    impl->hydrate();
     impl->mCacheMembers.insert(uuid);
     impl->mContext.mLandMembers.emplace_back(uuid.asString());
+    impl->initMemberIds();
     impl->mDirtyCounter.increment();
+    _syncIndexes();
+    _journal(LandMutation::AddMember, impl->mContext.mLandMembers.back());
 }
 void Land::removeLandMember(mce::UUID const& uuid) {
+    impl->hydrate();
     impl->mCacheMembers.erase(uuid);
-    std::erase_if(impl->mContext.mLandMembers, [uuid = uuid.asString()](auto const& u) { return u == uuid; });
+    auto member = uuid.asString();
+    std::erase_if(impl->mContext.mLandMembers, [&member](auto const& u) { return u == member; });
+    impl->initMemberIds();
     impl->mDirtyCounter.increment();
+    _syncIndexes();
+    _journal(LandMutation::RemoveMember, member);
 }
 
 std::string const& Land::getName() const { return impl->mContext.mLandName; }
-void               Land::setName(std::string const& name) {
+void Land::setName(std::string const& name) {
     impl->mContext.mLandName = name;
     impl->mDirtyCounter.increment();
+    _syncIndexes();
+    _journal(LandMutation::Name, name);
 }
 
 int  Land::getOriginalBuyPrice() const { return impl->mContext.mOriginalBuyPrice; }
 void Land::setOriginalBuyPrice(int price) {
     impl->mContext.mOriginalBuyPrice = price;
     impl->mDirtyCounter.increment();
+    _journal(LandMutation::Price);
 }
 
 bool                Land::is3D() const { return impl->mContext.mIs3DLand; }
 bool                Land::isOwner(mce::UUID const& uuid) const { return impl->mCacheOwner == uuid; }
-bool                Land::isMember(mce::UUID const& uuid) const { return impl->mCacheMembers.contains(uuid); }
+bool                Land::isMember(mce::UUID const& uuid) const { return impl->hasMemberId(uuid); }
 bool                Land::isConvertedLand() const { return impl->mContext.mIsConvertedLand; }
 bool                Land::isOwnerDataIsXUID() const { return impl->mContext.mOwnerDataIsXUID; }
 bool                Land::isDirty() const { return impl->mDirtyCounter.isDirty(); }
@@ -193,33 +281,57 @@ void Land::migrateOwner(mce::UUID const& ownerUUID) {
         setOwner(ownerUUID);
         impl->mContext.mOwnerDataIsXUID = false;
         impl->mDirtyCounter.increment();
+        _journal(LandMutation::Identity);
     }
 }
 
 void Land::load(nlohmann::json& json) {
+    impl->dropCold();
     json_util::json2structWithVersionPatch(json, impl->mContext, true);
     impl->initCache();
 }
-nlohmann::json Land::toJson() const { return json_util::struct2json(impl->mContext); }
+nlohmann::json Land::toJson() const { return json_util::struct2json(_getContext()); }
 
 bool Land::operator==(Land const& other) const { return impl->mContext.mLandID == other.impl->mContext.mLandID; }
 
 
 // friend LandHierarchyService API
-LandContext& Land::_getContext() const { return impl->mContext; }
+LandContext& Land::_getContext() const {
+    impl->hydrate();
+    return impl->mContext;
+}
 void         Land::_setCachedNestedLevel(int level) { impl->mCacheNestedLevel = level; }
 void         Land::_setLandId(LandID id) { impl->mContext.mLandID = id; }
 void         Land::_reinit(LandContext context, unsigned int dirtyDiff) {
+    impl->dropCold();
     impl->mContext = std::move(context);
     impl->mDirtyCounter.reset(dirtyDiff);
     impl->initCache();
 }
+void Land::_compact() { impl->compact(); }
+void Land::_syncIndexes() const {
+    if (getId() != INVALID_LAND_ID) {
+        PLand::getInstance().getLandRegistry()._syncIndexes(*this);
+    }
+}
+void Land::_journal(LandMutation mutation, std::string_view value) const {
+    if (getId() != INVALID_LAND_ID) {
+        PLand::getInstance().getLandRegistry()._journal(*this, mutation, value);
+    }
+}
+std::string Land::_encodeFields(uint8_t groups) const {
+    if (groups & internal::LandContextCodec::Cold) {
+        impl->hydrate();
+    }
+    return internal::LandContextCodec::encode(impl->mContext, groups);
+}
 bool Land::_setAABB(LandAABB const& newRange) {
     if (!isOrdinaryLand()) {
         return false;
     }
     impl->mContext.mPos = newRange;
     markDirty();
+    _journal(LandMutation::Range);
     return true;
 }
 
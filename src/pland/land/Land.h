@@ -7,6 +7,7 @@
 
 #include "nlohmann/json.hpp"
 
+#include <string_view>
 #include <unordered_set>
 #include <vector>
 
@@ -16,10 +17,14 @@ class UUID;
 };
 
 namespace land {
+enum class LandMutation : uint8_t;
 namespace service {
 class LandHierarchyService;
 class LandManagementService;
 } // namespace service
+namespace test {
+struct LandTestAccess;
+}
 
 
 class Land final : std::enable_shared_from_this<Land> {
@@ -199,6 +204,28 @@ class Land final : std::enable_shared_from_this<Land> {
 
     void _reinit(LandContext context, unsigned int dirtyDiff);
 
+    /**
+     * @brief 将冷字段(成员)压缩为紧凑编码，首次访问时再展开
+     * @warning 压缩会使此前获取的成员引用失效，仅可在领地对外可见前调用
+     */
+    void _compact();
+
+    /**
+     * @brief 主人、成员或名称变更后，同步 LandRegistry 中的二级索引
+     */
+    void _syncIndexes() const;
+
+    /**
+     * @brief 将变更记录到 LandRegistry 的变更日志
+     */
+    void _journal(LandMutation mutation, std::string_view value = {}) const;
+
+    /**
+     * @brief 按字段分组编码领地数据(LandContextCodec::Group)
+     * @note 不含冷字段分组时不会展开冷字段
+     */
+    std::string _encodeFields(uint8_t groups) const;
+
     /**
      * @brief 修改领地范围(仅限普通领地)
      * @warning 修改后务必在 LandRegistry 中刷新领地范围，否则范围不会更新
@@ -210,6 +237,7 @@ class Land final : std::enable_shared_from_this<Land> {
     friend class TransactionContext;
     friend service::LandHierarchyService;
     friend service::LandManagementService;
+    friend test::LandTestAccess;
 };
 
 
@@ -19,6 +19,7 @@
 
 #include "pland/Global.h"
 #include "pland/PLand.h"
+#include "pland/aabb/LandAABB.h"
 #include "pland/events/player/PlayerMoveEvent.h"
 #include "pland/land/Config.h"
 #include "pland/land/Land.h"
@@ -31,9 +32,41 @@
 namespace land::internal {
 
 struct LandScheduler::Impl {
+    /**
+     * @brief 玩家所在领地缓存
+     * 玩家在两次调度之间通常停留在同一领地或同一荒野区块内，满足以下条件时直接复用上次的查询结果：
+     *   1. 领地索引代数未变化(领地增删、范围或层级变化均会使缓存失效)，且维度未变化
+     *   2. 上次位于领地内: 仍在该领地范围内，且该领地没有子领地(否则可能进入子领地)
+     *   3. 上次位于荒野: 仍在同一区块内，且该区块内没有登记任何领地
+     */
+    struct LandCache {
+        uint64_t  mGeneration{0};            // 索引代数
+        LandDimid mDimId{0};                 // 维度
+        int       mChunkX{0};                // 区块 X
+        int       mChunkZ{0};                // 区块 Z
+        LandID    mLandId{INVALID_LAND_ID};  // 领地ID
+        LandAABB  mAABB{};                   // 领地范围
+        bool      mIs3D{false};              // 是否为3D领地
+        bool      mReusable{false};          // 是否可复用
+
+        [[nodiscard]] bool hit(uint64_t generation, LandDimid dimId, BlockPos const& pos) const {
+            if (!mReusable || mGeneration != generation || mDimId != dimId) {
+                return false;
+            }
+            if (mLandId != INVALID_LAND_ID) {
+                return mAABB.hasPos(pos, mIs3D);
+            }
+            return mChunkX == (pos.x >> 4) && mChunkZ == (pos.z >> 4);
+        }
+    };
+
     std::vector<Player*>                   mPlayers{};
     std::unordered_map<Player*, LandDimid> mDimensionMap{};
     std::unordered_map<Player*, LandID>    mLandIdMap{};
+    std::unordered_map<Player*, LandCache> mLandCacheMap{};
+
+    uint64_t mCacheHits{0};   // 缓存命中次数
+    uint64_t mCacheMisses{0}; // 缓存未命中次数
 
     ll::event::ListenerPtr mPlayerJoinServerListener{nullptr};
     ll::event::ListenerPtr mPlayerDisconnectListener{nullptr};
@@ -43,9 +76,36 @@ struct LandScheduler::Impl {
     std::shared_ptr<ll::coro::InterruptableSleep> mEventSchedulingSleep{nullptr};
     std::shared_ptr<ll::coro::InterruptableSleep> mLandTipSchedulingSleep{nullptr};
 
-    void tickEvent() {
-        auto& bus      = ll::event::EventBus::getInstance();
+    LandID _queryLandId(Player* player, BlockPos const& pos, LandDimid dimId, uint64_t generation) {
+        auto& cache = mLandCacheMap[player];
+        if (cache.hit(generation, dimId, pos)) {
+            ++mCacheHits;
+            return cache.mLandId;
+        }
+        ++mCacheMisses;
+
         auto& registry = PLand::getInstance().getLandRegistry();
+        auto  land     = registry.getLandAt(pos, dimId);
+
+        cache.mGeneration = generation;
+        cache.mDimId      = dimId;
+        cache.mChunkX     = pos.x >> 4;
+        cache.mChunkZ     = pos.z >> 4;
+        if (land) {
+            cache.mLandId   = land->getId();
+            cache.mAABB     = land->getAABB();
+            cache.mIs3D     = land->is3D();
+            cache.mReusable = !land->hasSubLand();
+        } else {
+            cache.mLandId   = INVALID_LAND_ID;
+            cache.mReusable = !registry.hasLandInChunk(cache.mChunkX, cache.mChunkZ, dimId);
+        }
+        return cache.mLandId;
+    }
+
+    void tickEvent() {
+        auto& bus        = ll::event::EventBus::getInstance();
+        auto  generation = PLand::getInstance().getLandRegistry().getGeneration();
 
         auto iter = mPlayers.begin();
         while (iter != mPlayers.end()) {
@@ -58,8 +118,7 @@ struct LandScheduler::Impl {
                 int&  lastDimId  = mDimensionMap[player];
                 auto& lastLandID = mLandIdMap[player];
 
-                auto   land          = registry.getLandAt(currentPos, currentDimId);
-                LandID currentLandId = land ? land->getId() : INVALID_LAND_ID;
+                LandID currentLandId = _queryLandId(player, currentPos, currentDimId, generation);
 
                 // 处理维度变化
                 if (currentDimId != lastDimId) {
@@ -96,7 +155,7 @@ struct LandScheduler::Impl {
                 continue;
             }
 
-            if (!registry.getOrCreatePlayerSettings(player->getUuid()).showBottomContinuedTip) {
+            if (!registry.getPlayerSettings(player->getUuid()).showBottomContinuedTip) {
                 continue; // 如果玩家设置不显示底部提示，则跳过
             }
 
@@ -148,6 +207,7 @@ LandScheduler::LandScheduler() : impl(std::make_unique<Impl>()) {
             auto ptr = &player;
             impl->mDimensionMap.erase(ptr);
             impl->mLandIdMap.erase(ptr);
+            impl->mLandCacheMap.erase(ptr);
             std::erase_if(impl->mPlayers, [&ptr](auto* p) { return p == ptr; });
         });
 
@@ -160,7 +220,7 @@ LandScheduler::LandScheduler() : impl(std::make_unique<Impl>()) {
             auto& player   = ev.self();
             auto& registry = PLand::getInstance().getLandRegistry();
 
-            if (!registry.getOrCreatePlayerSettings(player.getUuid()).showEnterLandTitle) {
+            if (!registry.getPlayerSettings(player.getUuid()).showEnterLandTitle) {
                 return; // 如果玩家设置不显示进入领地提示,则不显示
             }
 
@@ -251,6 +311,16 @@ LandScheduler::~LandScheduler() {
     impl->mPlayers.clear();
     impl->mDimensionMap.clear();
     impl->mLandIdMap.clear();
+    impl->mLandCacheMap.clear();
+}
+
+LandScheduler::CacheStats LandScheduler::getCacheStats() const {
+    return {.mHits = impl->mCacheHits, .mMisses = impl->mCacheMisses};
+}
+
+void LandScheduler::resetCacheStats() {
+    impl->mCacheHits   = 0;
+    impl->mCacheMisses = 0;
 }
 
 
@@ -1,6 +1,8 @@
 #pragma once
 #include "pland/Global.h"
 
+#include <cstdint>
+
 class Player;
 
 namespace land::internal {
@@ -18,6 +20,23 @@ class LandScheduler {
     LD_DISABLE_COPY_AND_MOVE(LandScheduler);
     explicit LandScheduler();
     ~LandScheduler();
+
+    /**
+     * @brief 玩家所在领地缓存统计
+     */
+    struct CacheStats {
+        uint64_t mHits{0};   // 命中次数(复用上次结果)
+        uint64_t mMisses{0}; // 未命中次数(完整查询)
+
+        [[nodiscard]] double hitRate() const {
+            auto total = mHits + mMisses;
+            return total == 0 ? 0.0 : static_cast<double>(mHits) / static_cast<double>(total);
+        }
+    };
+
+    [[nodiscard]] CacheStats getCacheStats() const;
+
+    void resetCacheStats();
 };
 
 
@@ -1,13 +1,23 @@
 #include "LandRegistry.h"
 #include "StorageError.h"
 #include "TransactionContext.h"
+#include "internal/LandContextCodec.h"
+#include "internal/LandContextJsonReader.h"
 #include "internal/LandDimensionChunkMap.h"
 #include "internal/LandIdAllocator.h"
+#include "internal/LandIndexPersistence.h"
+#include "internal/LandIndexSnapshot.h"
+#include "internal/LandJournal.h"
+#include "internal/LandOwnershipIndex.h"
 #include "internal/LandMigrator.h"
+#include "internal/LandNameIndex.h"
+#include "internal/LandPointQuery.h"
+#include "internal/PlayerSettingsStore.h"
 
 #include "pland/Global.h"
 #include "pland/PLand.h"
 #include "pland/aabb/LandAABB.h"
+#include "pland/land/Config.h"
 #include "pland/land/Land.h"
 #include "pland/land/LandTemplatePermTable.h"
 #include "pland/land/repo/LandContext.h"
@@ -15,9 +25,11 @@
 #include "pland/utils/JsonUtil.h"
 
 #include "ll/api/Expected.h"
+#include "ll/api/chrono/GameChrono.h"
 #include "ll/api/coro/CoroTask.h"
 #include "ll/api/coro/InterruptableSleep.h"
 #include "ll/api/data/KeyValueDB.h"
+#include "ll/api/thread/ServerThreadExecutor.h"
 #include "ll/api/thread/ThreadPoolExecutor.h"
 
 #include "mc/platform/UUID.h"
@@ -32,13 +44,23 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cassert>
 #include <chrono>
+#include <condition_variable>
+#include <exception>
 #include <filesystem>
+#include <iterator>
+#include <latch>
 #include <memory>
 #include <mutex>
+#include <numeric>
+#include <optional>
 #include <shared_mutex>
+#include <stack>
 #include <stdexcept>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -48,69 +70,483 @@
 namespace land {
 
 struct LandRegistry::Impl {
-    std::unique_ptr<ll::data::KeyValueDB>              mDB;                             // 领地数据库
-    std::vector<mce::UUID>                             mLandOperators;                  // 领地操作员
-    std::unordered_map<mce::UUID, PlayerSettings>      mPlayerSettings;                 // 玩家设置
-    absl::flat_hash_map<LandID, std::shared_ptr<Land>> mLandCache;                      // 领地缓存
-    mutable std::shared_mutex                          mMutex;                          // 读写锁
-    std::unique_ptr<internal::LandIdAllocator>         mLandIdAllocator{nullptr};       // 领地ID分配器
-    internal::LandDimensionChunkMap                    mDimensionChunkMap;              // 维度区块映射
-    std::unique_ptr<LandTemplatePermTable>             mLandTemplatePermTable{nullptr}; // 领地模板权限表
+    using SnapshotPtr = std::shared_ptr<internal::LandIndexSnapshot const>;
+
+    /**
+     * @brief 领地操作员集合
+     * 与索引快照相同，发布后不可变，变更时整体替换
+     */
+    struct OperatorSet {
+        std::vector<mce::UUID>        mList; // 按添加顺序排列(持久化与展示)
+        std::unordered_set<mce::UUID> mSet;  // 哈希集合(查询)
+    };
+    using OperatorSetPtr = std::shared_ptr<OperatorSet const>;
+
+    /**
+     * @brief 旧接口 getOrCreatePlayerSettings 交出的玩家设置
+     * 调用方直接修改 mValue，与 mSynced 比较即可得知是否需要写回设置存储
+     */
+    struct LegacySettings {
+        PlayerSettings mValue;  // 交给调用方的可变设置
+        PlayerSettings mSynced; // 上次与设置存储同步时的值
+    };
+
+    /**
+     * @brief 待写入数据库的数据
+     * 在持有 mMutex 的线程上复制，序列化与写入在线程池上进行
+     */
+    struct SaveBatch {
+        struct LandEntry {
+            std::shared_ptr<Land> mLand;    // 领地对象(写入前确认仍已登记)
+            LandContext           mContext; // 捕获时的数据副本
+            unsigned int          mDirty;   // 捕获时的脏计数
+        };
+
+        std::vector<LandEntry>                                                mLands;             // 领地
+        std::optional<std::vector<mce::UUID>>                                 mOperators;         // 操作员
+        std::optional<LandPermTable>                                          mTemplatePermTable; // 模板权限表
+        std::vector<std::pair<size_t, internal::PlayerSettingsStore::MapPtr>> mPlayerSettings;    // 玩家设置分片
+        internal::LandJournal::Mark                                           mJournalMark{0};    // 复制时的日志位置(0 不截断)
+
+        [[nodiscard]] bool empty() const {
+            return mLands.empty() && !mOperators && !mTemplatePermTable && mPlayerSettings.empty();
+        }
+        void append(SaveBatch&& other) {
+            std::move(other.mLands.begin(), other.mLands.end(), std::back_inserter(mLands));
+            std::move(other.mPlayerSettings.begin(), other.mPlayerSettings.end(), std::back_inserter(mPlayerSettings));
+            if (other.mOperators) {
+                mOperators = std::move(other.mOperators);
+            }
+            if (other.mTemplatePermTable) {
+                mTemplatePermTable = std::move(other.mTemplatePermTable);
+            }
+            mJournalMark = std::max(mJournalMark, other.mJournalMark);
+        }
+    };
+
+    std::unique_ptr<ll::data::KeyValueDB>           mDB;                             // 领地数据库
+    std::atomic<OperatorSetPtr>                     mOperators;                      // 领地操作员(读路径无锁，写者持有 mMutex 替换)
+    std::atomic<bool>                               mOperatorsDirty{false};          // 操作员自上次保存后是否变化
+    std::atomic<uint64_t>                           mOperatorsVersion{0};            // 操作员列表版本
+    internal::PlayerSettingsStore                   mPlayerSettings;                 // 玩家设置(分片，读路径无锁)
+    std::unordered_map<mce::UUID, std::unique_ptr<LegacySettings>> mLegacySettings;  // 旧接口交出的可变玩家设置
+    std::mutex                                      mLegacySettingsMutex;            // 旧接口玩家设置锁
+    std::atomic<SnapshotPtr>                        mSnapshot;                       // 领地索引快照(读路径无锁)
+    std::atomic<internal::LandIndexSnapshot const*> mSnapshotView{nullptr};          // 当前快照的裸指针视图(借用查询)
+    std::atomic<uint64_t>                           mGeneration{0};                  // 当前快照代数
+    std::vector<std::pair<uint64_t, SnapshotPtr>>   mRetiredSnapshots;               // 已退役快照(退役时的回收周期, 快照)
+    uint64_t                                        mRetireEpoch{0};                 // 回收周期(每 tick 加一，受 mRetireMutex 保护)
+    std::mutex                                      mRetireMutex;                    // 退役快照锁
+    mutable std::shared_mutex                       mMutex;                          // 读写锁(写者互斥 & 非索引数据)
+    std::unique_ptr<internal::LandIdAllocator>      mLandIdAllocator{nullptr};       // 领地ID分配器
+    std::unique_ptr<LandTemplatePermTable>          mLandTemplatePermTable{nullptr}; // 领地模板权限表
+    std::filesystem::path                           mIndexSnapshotFile;              // 空间索引快照文件
+    internal::LandOwnershipIndex                    mOwnershipIndex;                 // 领地归属索引
+    internal::LandNameIndex                         mNameIndex;                      // 领地名称索引
+    mutable std::shared_mutex                       mSecondaryIndexMutex;            // 二级索引锁(独立于 mMutex)
+    ll::thread::ThreadPoolExecutor*                 mSavePool{nullptr};              // 保存任务线程池
+    std::unique_ptr<ll::thread::ThreadPoolExecutor> mEncodePool{nullptr};            // 保存时的序列化线程池
+    size_t                                          mEncodeWorkers{0};               // 序列化线程池线程数
+    SaveBatch                                       mSaveQueue;                      // 等待写入的数据
+    bool                                            mSaveRunning{false};             // 是否有保存任务在执行
+    std::mutex                                      mSaveMutex;                      // 保存队列锁
+    std::condition_variable                         mSaveIdle;                       // 保存任务结束通知
+    std::mutex                                      mCaptureMutex;                   // 复制脏数据互斥(复制时清除脏标记)
+    std::mutex                                      mDbWriteMutex;                   // 领地写入/删除互斥
+    std::unique_ptr<internal::LandJournal>          mJournal;                        // 领地变更日志(未启用时为空)
+
+    bool                                                            mBinaryFormat{false}; // 领地数据以二进制格式写入
+    std::unordered_map<int, internal::LandContextCodec::PermLayout> mPermLayouts;         // 结构版本 --> 权限表位序
+    std::mutex                                                      mPermLayoutMutex;     // 权限表位序缓存锁
 
     ll::coro::InterruptableSleep mInterruptableSleep; // 中断等待
+    ll::coro::InterruptableSleep mReclaimSleep;       // 快照回收等待
     std::atomic_bool             mCoroAbort{false};   // 协程中断标志
 
+    /**
+     * @brief 获取当前索引快照
+     * @note 无锁，返回的快照在持有期间保持不变
+     */
+    SnapshotPtr snapshot() const { return mSnapshot.load(std::memory_order_acquire); }
+
+    /**
+     * @brief 复制当前快照，用于写入
+     * @note 调用方必须持有 mMutex 写锁，修改完成后通过 _publish 发布
+     */
+    std::shared_ptr<internal::LandIndexSnapshot> _beginWrite() const {
+        return std::make_shared<internal::LandIndexSnapshot>(*snapshot());
+    }
+
+    void _publish(std::shared_ptr<internal::LandIndexSnapshot> next) {
+        next->mGeneration = snapshot()->mGeneration + 1;
+
+        auto view       = next.get();
+        auto generation = next->mGeneration;
+        auto old        = mSnapshot.exchange(std::move(next), std::memory_order_acq_rel);
+        mSnapshotView.store(view, std::memory_order_release);
+        mGeneration.store(generation, std::memory_order_release);
+
+        // 旧快照可能仍被借用查询(findLandAt)引用，按退役时的回收周期延迟释放
+        std::lock_guard guard(mRetireMutex);
+        mRetiredSnapshots.emplace_back(mRetireEpoch, std::move(old));
+    }
+
+    /**
+     * @brief 回收已退役的快照(每 tick 在服务器线程上调用一次)
+     * 回收协程在 tick 内的执行时机不固定，同一 tick 内先借用、后退役的快照在本 tick 的回收中可能已满一个周期，
+     * 因此只释放退役后经过两个回收周期的快照，保证借用指针在取得它的整个 tick 内有效
+     */
+    void _reclaimRetiredSnapshots() {
+        std::vector<SnapshotPtr> expired;
+        {
+            std::lock_guard guard(mRetireMutex);
+            auto const epoch = ++mRetireEpoch;
+            auto       keep  = mRetiredSnapshots.begin();
+            for (auto& entry : mRetiredSnapshots) {
+                if (entry.first + 2 <= epoch) {
+                    expired.push_back(std::move(entry.second));
+                } else {
+                    *keep++ = std::move(entry);
+                }
+            }
+            mRetiredSnapshots.erase(keep, mRetiredSnapshots.end());
+        }
+        // 在锁外析构，避免长时间持有锁
+    }
+
+    /**
+     * @brief 获取当前操作员集合
+     * @note 无锁，任意线程可调用；返回的集合在持有期间保持不变
+     */
+    OperatorSetPtr operators() const { return mOperators.load(std::memory_order_acquire); }
+
+    /**
+     * @brief 发布新的操作员集合
+     * @note 调用方必须持有 mMutex 写锁；旧集合由最后一个持有者释放
+     */
+    void _publishOperators(std::vector<mce::UUID> list) {
+        auto next   = std::make_shared<OperatorSet>();
+        next->mSet  = {list.begin(), list.end()};
+        next->mList = std::move(list);
+        mOperators.store(std::move(next), std::memory_order_release);
+        mOperatorsVersion.fetch_add(1, std::memory_order_acq_rel);
+    }
+
     void _loadOperators(ll::io::Logger& logger) {
         if (!mDB->has(DbOperatorDataKey)) {
             mDB->set(DbOperatorDataKey, "[]"); // empty array
         }
         auto ops = nlohmann::json::parse(*mDB->get(DbOperatorDataKey));
+
+        std::vector<mce::UUID> operators;
         for (auto& op : ops) {
             auto uuidStr = op.get<std::string>();
             if (!mce::UUID::canParse(uuidStr)) {
                 logger.warn("Invalid operator UUID: {}", uuidStr);
             }
-            mLandOperators.emplace_back(uuidStr);
+            operators.emplace_back(uuidStr);
         }
+        _publishOperators(std::move(operators));
     }
-    void _loadPlayerSettings() {
-        if (!mDB->has(DbPlayerSettingDataKey)) {
-            mDB->set(DbPlayerSettingDataKey, "{}"); // empty object
+    static std::string _playerSettingsKey(size_t shard) {
+        return fmt::format("{}.{}", DbPlayerSettingDataKey, shard);
+    }
+    static std::string _permLayoutKey(int schema) { return fmt::format("{}{}__", DbPermLayoutKey, schema); }
+
+    /**
+     * @brief 记录当前结构版本的权限表位序
+     * 二进制数据按位序存储权限，结构升级后需要依据写入时的位序还原为 JSON 再交由 LandMigrator 升级
+     */
+    void _ensurePermLayout() {
+        auto key = _permLayoutKey(LandSchemaVersion);
+        if (!mDB->has(key)) {
+            auto const& layout = internal::LandContextCodec::currentPermLayout();
+            mDB->set(key, json_util::struct2json(layout).dump());
+        }
+    }
+    internal::LandContextCodec::PermLayout const& _permLayout(int schema) {
+        std::lock_guard guard(mPermLayoutMutex);
+        if (auto iter = mPermLayouts.find(schema); iter != mPermLayouts.end()) {
+            return iter->second;
+        }
+        auto raw = mDB->get(_permLayoutKey(schema));
+        if (!raw) {
+            throw std::runtime_error(fmt::format("Missing permission layout of land schema {}", schema));
+        }
+        auto json   = nlohmann::json::parse(*raw);
+        auto layout = internal::LandContextCodec::PermLayout{};
+        json_util::json2struct(json, layout);
+        return mPermLayouts.emplace(schema, std::move(layout)).first->second;
+    }
+
+    static LandContext _migrateLand(nlohmann::json json) {
+        if (auto expected = internal::LandMigrator::getInstance().migrate(json, LandSchemaVersion); !expected) {
+            throw std::runtime_error{expected.error().message()};
         }
-        auto settings = nlohmann::json::parse(*mDB->get(DbPlayerSettingDataKey));
+        LandContext context;
+        json_util::json2structWithVersionPatch(json, context, true);
+        return context;
+    }
+
+    /**
+     * @brief 解码数据库中的领地数据
+     * 自动识别 JSON 与二进制格式；旧结构版本的数据经 LandMigrator 升级
+     */
+    LandContext _decodeLand(std::string_view raw) {
+        using Codec = internal::LandContextCodec;
+        if (!Codec::isBinary(raw)) {
+            return _migrateLand(nlohmann::json::parse(raw));
+        }
+
+        auto context = LandContext{.mLandName = {}}; // 名称必定由数据提供
+        if (Codec::decode(raw, context)) {
+            return context;
+        }
+        auto schema = Codec::peekSchema(raw);
+        if (!schema || *schema >= LandSchemaVersion) {
+            throw std::runtime_error("Corrupted binary land data");
+        }
+        auto json = Codec::decodeToJson(raw, _permLayout(*schema));
+        if (!json) {
+            throw std::runtime_error("Corrupted binary land data");
+        }
+        return _migrateLand(std::move(*json));
+    }
+    std::string _encodeLand(LandContext const& context) const {
+        if (mBinaryFormat) {
+            return internal::LandContextCodec::encode(context);
+        }
+        return json_util::struct2json(context).dump();
+    }
+
+    static internal::PlayerSettingsStore::Map _parsePlayerSettings(std::string const& raw) {
+        auto settings = nlohmann::json::parse(raw);
         if (!settings.is_object()) {
             throw std::runtime_error("player settings is not an object");
         }
 
+        internal::PlayerSettingsStore::Map result;
         for (auto& [key, value] : settings.items()) {
             PlayerSettings settings_;
             json_util::json2structWithDiffPatch(value, settings_);
-            mPlayerSettings.emplace(key, std::move(settings_));
+            result.emplace(key, std::move(settings_));
         }
+        return result;
     }
-    void _loadLands() {
-        ll::coro::Generator<std::pair<std::string_view, std::string_view>> iter = mDB->iter();
+    void _loadPlayerSettings() {
+        // 旧版本将所有玩家设置保存在同一个键中，先载入再由分片数据覆盖(迁移中断时分片数据更新)
+        auto legacy = mDB->get(DbPlayerSettingDataKey);
+        if (legacy) {
+            mPlayerSettings.load(_parsePlayerSettings(*legacy), true);
+        }
+        for (size_t i = 0; i < internal::PlayerSettingsStore::ShardCount; ++i) {
+            if (auto raw = mDB->get(_playerSettingsKey(i))) {
+                mPlayerSettings.load(_parsePlayerSettings(*raw), false);
+            }
+        }
+        if (legacy && _savePlayerSettings()) {
+            mDB->del(DbPlayerSettingDataKey);
+        }
+    }
+    /**
+     * @brief 同步一份旧接口交出的玩家设置
+     * 引用被修改过则写入设置存储，否则从设置存储刷新(接收经由新接口的修改)
+     */
+    void _syncLegacySettings(mce::UUID const& uuid, LegacySettings& entry) {
+        if (entry.mValue != entry.mSynced) {
+            mPlayerSettings.set(uuid, entry.mValue);
+            entry.mSynced = entry.mValue;
+        } else {
+            entry.mValue = entry.mSynced = mPlayerSettings.get(uuid);
+        }
+    }
+    void _flushLegacySettings() {
+        std::lock_guard guard(mLegacySettingsMutex);
+        for (auto& [uuid, entry] : mLegacySettings) {
+            _syncLegacySettings(uuid, *entry);
+        }
+    }
+    /**
+     * @brief 写回发生变化的玩家设置分片
+     * @return 是否全部写入成功
+     */
+    bool _savePlayerSettings() {
+        bool ok = true;
+        for (auto const& [shard, map] : mPlayerSettings.takeDirty()) {
+            if (!mDB->set(_playerSettingsKey(shard), json_util::struct2json(*map).dump())) {
+                mPlayerSettings.markDirty(shard);
+                ok = false;
+            }
+        }
+        return ok;
+    }
+    /**
+     * @brief 并行执行 task(0) ~ task(count - 1)
+     * @note 当前线程执行第 0 个任务，其余任务投递到线程池；全部完成后重新抛出首个异常
+     */
+    template <typename Fn>
+    static void _parallelFor(ll::thread::ThreadPoolExecutor& pool, size_t count, Fn const& task) {
+        if (count == 0) {
+            return;
+        }
+        std::vector<std::exception_ptr> errors(count);
+        std::latch                      done{static_cast<std::ptrdiff_t>(count)};
+
+        auto run = [&](size_t i) {
+            try {
+                task(i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+            done.count_down();
+        };
+        for (size_t i = 1; i < count; ++i) {
+            pool.execute([&run, i] { run(i); });
+        }
+        run(0);
+        done.wait();
 
-        auto& landMigrator = internal::LandMigrator::getInstance();
+        for (auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
 
-        LandID safeId{0};
-        for (auto [key, value] : iter) {
-            if (!isLandData(key)) continue;
+    /**
+     * @brief 按数据量与线程池实际线程数计算并行分组数
+     * @param workers 线程池线程数；调用线程自身执行第 0 组，分组数至多为 workers + 1
+     */
+    static size_t _sliceCount(size_t total, size_t workers) {
+        constexpr size_t MinSliceSize = 256; // 每组最少处理的领地数量，过小的分组调度开销大于收益
+
+        return std::clamp<size_t>(total / MinSliceSize, 1, workers + 1);
+    }
 
-            auto json = nlohmann::json::parse(value);
-            if (auto expected = landMigrator.migrate(json, LandSchemaVersion); !expected) {
-                throw std::runtime_error{expected.error().message()};
+    /**
+     * @brief 启动加载、保存序列化专用线程池的线程数
+     * @note 插件线程池仅 2 个线程，按其分组无法利用多核；加载线程池按硬件线程数创建，加载完成后即销毁
+     */
+    static size_t _workerCount() {
+        return std::max(1u, std::thread::hardware_concurrency()) - 1; // 构造线程自身也参与加载
+    }
+
+    /**
+     * @brief 领地加载各阶段耗时
+     * @note 解析、迁移、反序列化在各线程上并行执行，记录的是各线程耗时之和
+     */
+    struct LoadProfile {
+        std::chrono::nanoseconds mIterate{0};   // 遍历数据库
+        std::chrono::nanoseconds mParse{0};     // 解析(流式解析为完整耗时，DOM 路径仅为构建 DOM)
+        std::chrono::nanoseconds mMigrate{0};   // 数据迁移
+        std::chrono::nanoseconds mLoad{0};      // 反序列化
+        std::chrono::nanoseconds mParallel{0};  // 并行阶段总耗时(墙钟)
+        std::chrono::nanoseconds mHierarchy{0}; // 构建层级缓存
+        std::chrono::nanoseconds mIndex{0};     // 构建空间索引
+        size_t                   mSlices{0};    // 并行分组数
+        size_t                   mMigrated{0};  // 经 DOM + LandMigrator 加载的领地数
+    };
+
+    void _loadLands(
+        internal::LandIndexSnapshot&                 index,
+        ll::thread::ThreadPoolExecutor&              pool,
+        size_t                                       workers,
+        LoadProfile&                                 profile,
+        internal::LandIndexPersistence::Fingerprint& fingerprint
+    ) {
+        using Clock = std::chrono::steady_clock;
+
+        // 数据库迭代器不支持并发访问，先顺序读取原始数据
+        auto begin = Clock::now();
+
+        std::vector<std::string> records;
+        for (auto [key, value] : mDB->iter()) {
+            if (isLandData(key)) {
+                fingerprint.update(key, value);
+                records.emplace_back(value);
             }
+        }
+        profile.mIterate = Clock::now() - begin;
+
+        struct LoadSlice {
+            std::vector<std::shared_ptr<Land>> mLands;
+            std::chrono::nanoseconds           mParse{0};
+            std::chrono::nanoseconds           mMigrate{0};
+            std::chrono::nanoseconds           mLoad{0};
+            size_t                             mMigrated{0};
+        };
+
+        auto const sliceCount = _sliceCount(records.size(), workers);
+        auto const sliceSize  = (records.size() + sliceCount - 1) / sliceCount;
+
+        std::vector<LoadSlice> slices(sliceCount);
+        begin = Clock::now();
+        _parallelFor(pool, sliceCount, [&](size_t i) {
+            auto& landMigrator = internal::LandMigrator::getInstance();
+            auto& slice        = slices[i];
+
+            auto const first = std::min(records.size(), i * sliceSize);
+            auto const last  = std::min(records.size(), first + sliceSize);
+            slice.mLands.reserve(last - first);
+            for (auto idx = first; idx < last; ++idx) {
+                auto raw = std::move(records[idx]); // 解析后立即释放原始数据，降低加载峰值内存
+                auto t0  = Clock::now();
+
+                // 当前结构版本的数据直接解码到 LandContext；名称必定由数据提供，跳过默认名称的翻译查找
+                bool const binary  = internal::LandContextCodec::isBinary(raw);
+                auto       context = LandContext{.mLandName = {}};
+                bool const decoded = binary ? internal::LandContextCodec::decode(raw, context)
+                                            : internal::LandContextJsonReader::read(raw, context);
+                if (decoded) {
+                    slice.mParse += Clock::now() - t0;
+                    slice.mLands.push_back(Land::make(std::move(context)));
+                    continue;
+                }
+
+                ++slice.mMigrated;
+                if (binary) {
+                    slice.mLands.push_back(Land::make(_decodeLand(raw)));
+                    slice.mMigrate += Clock::now() - t0;
+                    continue;
+                }
+
+                auto json = nlohmann::json::parse(raw);
 
-            auto land = Land::make();
-            land->load(json);
+                auto t1 = Clock::now();
+                if (auto expected = landMigrator.migrate(json, LandSchemaVersion); !expected) {
+                    throw std::runtime_error{expected.error().message()};
+                }
+
+                auto t2   = Clock::now();
+                auto land = Land::make();
+                land->load(json);
 
-            // 保证landID唯一
-            if (safeId <= land->getId()) {
-                safeId = land->getId() + 1;
+                auto t3         = Clock::now();
+                slice.mParse   += t1 - t0;
+                slice.mMigrate += t2 - t1;
+                slice.mLoad    += t3 - t2;
+                slice.mLands.push_back(std::move(land));
             }
+        });
+        profile.mParallel = Clock::now() - begin;
+        profile.mSlices   = sliceCount;
+
+        LandID safeId{0};
+        index.mLandCache.reserve(records.size());
+        for (auto& slice : slices) {
+            profile.mParse    += slice.mParse;
+            profile.mMigrate  += slice.mMigrate;
+            profile.mLoad     += slice.mLoad;
+            profile.mMigrated += slice.mMigrated;
+
+            for (auto& land : slice.mLands) {
+                // 保证landID唯一
+                if (safeId <= land->getId()) {
+                    safeId = land->getId() + 1;
+                }
 
-            mLandCache.emplace(land->getId(), std::move(land));
+                index.mLandCache.try_emplace(land->getId(), std::move(land));
+            }
         }
 
         mLandIdAllocator = std::make_unique<internal::LandIdAllocator>(safeId); // 初始化ID分配器
@@ -197,13 +633,157 @@ struct LandRegistry::Impl {
         }
     }
 
-    void _buildDimensionChunkMap() {
-        for (auto& [id, land] : mLandCache) {
-            mDimensionChunkMap.addLand(land);
+    size_t _buildNestedLevelCache(internal::LandIndexSnapshot& index) {
+        std::vector<std::shared_ptr<Land>> familyTreeRoot{};
+        for (auto& land : index.mLandCache | std::views::values) {
+            if (land->isParentLand()) {
+                familyTreeRoot.push_back(land);
+            }
         }
+
+        std::stack<std::pair<std::shared_ptr<Land>, int>> stack{};
+        for (auto& root : familyTreeRoot) {
+            stack.emplace(root, 0);
+
+            while (!stack.empty()) {
+                auto [curr, level] = stack.top();
+                stack.pop();
+
+                curr->_setCachedNestedLevel(level);
+                for (auto id : curr->getSubLandIDs()) {
+                    if (auto sub = index.mLandCache.find(id)) {
+                        stack.emplace(*sub, level + 1);
+                    }
+                }
+            }
+        }
+        return familyTreeRoot.size();
+    }
+
+    /**
+     * @brief 分片并行构建空间索引，最后合并到快照
+     */
+    void _buildDimensionChunkMap(
+        internal::LandIndexSnapshot&    index,
+        ll::thread::ThreadPoolExecutor& pool,
+        size_t                          workers
+    ) {
+        std::vector<std::shared_ptr<Land>> lands;
+        lands.reserve(index.mLandCache.size());
+        for (auto& land : index.mLandCache | std::views::values) {
+            lands.push_back(land);
+        }
+
+        auto const shardCount = _sliceCount(lands.size(), workers);
+        auto const shardSize  = (lands.size() + shardCount - 1) / shardCount;
+
+        auto const&                                 options = index.mDimensionChunkMap.getOptions();
+        std::vector<internal::LandDimensionChunkMap> shards(shardCount, internal::LandDimensionChunkMap{options});
+        _parallelFor(pool, shardCount, [&](size_t i) {
+            auto const first = std::min(lands.size(), i * shardSize);
+            auto const last  = std::min(lands.size(), first + shardSize);
+            for (auto idx = first; idx < last; ++idx) {
+                shards[i].addLand(lands[idx]);
+            }
+        });
+
+        for (auto& shard : shards) {
+            index.mDimensionChunkMap.merge(std::move(shard));
+        }
+    }
+
+    /**
+     * @brief 将领地过滤条件转换为名称索引使用的ID过滤条件
+     */
+    static internal::LandNameIndex::Filter
+    _nameFilter(internal::LandIndexSnapshot const& index, CustomFilter const& filter) {
+        if (!filter) {
+            return {};
+        }
+        return [&index, &filter](LandID id) {
+            auto land = index.mLandCache.find(id);
+            return land && filter(*land);
+        };
+    }
+
+    /**
+     * @brief 按归属索引中的领地ID收集领地
+     * @param exclude 跳过该集合中已收集过的领地
+     */
+    static void _collectLands(
+        internal::LandIndexSnapshot const&           index,
+        internal::LandOwnershipIndex::LandSet const& ids,
+        std::vector<std::shared_ptr<Land>>&          out,
+        internal::LandOwnershipIndex::LandSet const* exclude = nullptr
+    ) {
+        out.reserve(out.size() + ids.size());
+        for (auto id : ids) {
+            if (exclude && exclude->contains(id)) {
+                continue;
+            }
+            if (auto land = index.mLandCache.find(id)) {
+                out.push_back(*land);
+            }
+        }
+    }
+
+    /**
+     * @brief 从快照恢复层级缓存与空间索引
+     * @return 快照不可用时返回 false，调用方需重建
+     */
+    bool _restoreIndex(internal::LandIndexSnapshot& index, uint64_t fingerprint) {
+        auto levels = internal::LandIndexPersistence::LevelTable{};
+        auto map    = internal::LandDimensionChunkMap{index.mDimensionChunkMap.getOptions()};
+        if (!internal::LandIndexPersistence::load(mIndexSnapshotFile, fingerprint, map, levels)) {
+            return false;
+        }
+
+        // 先完整校验，再写入层级缓存，避免校验失败时留下部分恢复的状态
+        if (levels.size() != index.mLandCache.size()) {
+            return false;
+        }
+        for (auto const& [id, level] : levels) {
+            if (!index.mLandCache.contains(id)) {
+                return false;
+            }
+        }
+        for (auto const& [id, level] : levels) {
+            (*index.mLandCache.find(id))->_setCachedNestedLevel(level);
+        }
+        index.mDimensionChunkMap = std::move(map);
+        return true;
+    }
+
+    /**
+     * @brief 写入空间索引快照
+     * @note 仅在所有领地均已落盘时写入，保证快照与数据库内容一致；调用方必须持有 mMutex 写锁
+     */
+    bool _persistIndex() {
+        auto index  = snapshot();
+        auto levels = internal::LandIndexPersistence::LevelTable{};
+        levels.reserve(index->mLandCache.size());
+        for (auto const& [id, land] : index->mLandCache) {
+            if (land->isDirty()) {
+                return false;
+            }
+            levels.emplace_back(id, land->getNestedLevel());
+        }
+
+        auto fingerprint = internal::LandIndexPersistence::Fingerprint{};
+        for (auto [key, value] : mDB->iter()) {
+            if (isLandData(key)) {
+                fingerprint.update(key, value);
+            }
+        }
+        return internal::LandIndexPersistence::save(
+            mIndexSnapshotFile,
+            fingerprint.value(),
+            index->mDimensionChunkMap,
+            levels
+        );
     }
 
-    ll::Expected<> _addLand(std::shared_ptr<Land> land, bool allocateId = true) {
+    ll::Expected<> _addLand(internal::LandIndexSnapshot& index, std::shared_ptr<Land> land, bool allocateId = true) {
         if (!land || (allocateId && land->getId() != INVALID_LAND_ID)) {
             return StorageError::make(StorageError::ErrorCode::InvalidLand, "The land is invalid or land ID is not -1");
         }
@@ -211,193 +791,616 @@ struct LandRegistry::Impl {
             land->_setLandId(mLandIdAllocator->nextId());
         }
 
-        auto result = mLandCache.emplace(land->getId(), land);
-        if (!result.second) {
+        if (!index.mLandCache.try_emplace(land->getId(), land).second) {
             return StorageError::make(StorageError::ErrorCode::CacheMapError, "Failed to insert land into cache map");
         }
 
-        mDimensionChunkMap.addLand(land);
+        index.mDimensionChunkMap.addLand(land);
         land->markDirty(); // 标记为脏数据, 避免持久化失败
+
+        {
+            std::unique_lock guard(mSecondaryIndexMutex);
+            mOwnershipIndex.add(*land);
+            mNameIndex.add(land->getId(), land->getName());
+        }
+        if (mJournal) {
+            mJournal->append(internal::LandJournal::Op::Upsert, land->getId(), _encodeLand(land->_getContext()));
+        }
         return {};
     }
-    ll::Expected<> _removeLand(std::shared_ptr<Land> const& ptr) {
-        mDimensionChunkMap.removeLand(ptr);
-        if (!mLandCache.erase(ptr->getId())) {
-            mDimensionChunkMap.addLand(ptr);
+    ll::Expected<> _removeLand(internal::LandIndexSnapshot& index, std::shared_ptr<Land> const& ptr) {
+        index.mDimensionChunkMap.removeLand(ptr);
+        if (!index.mLandCache.erase(ptr->getId())) {
+            index.mDimensionChunkMap.addLand(ptr);
             return StorageError::make(StorageError::ErrorCode::CacheMapError, "Failed to erase land from cache");
         }
 
+        std::lock_guard dbGuard(mDbWriteMutex); // 与保存任务互斥，避免已删除的领地被写回
         if (!this->mDB->del(std::to_string(ptr->getId()))) {
-            mLandCache.emplace(ptr->getId(), ptr); // rollback
-            mDimensionChunkMap.addLand(ptr);
+            index.mLandCache.try_emplace(ptr->getId(), ptr); // rollback
+            index.mDimensionChunkMap.addLand(ptr);
             return StorageError::make(StorageError::ErrorCode::DatabaseError, "Failed to delete land from database");
         }
+        if (mJournal) {
+            mJournal->append(internal::LandJournal::Op::Remove, ptr->getId());
+        }
+
+        std::unique_lock guard(mSecondaryIndexMutex);
+        mOwnershipIndex.remove(ptr->getId());
+        mNameIndex.remove(ptr->getId());
         return {};
     }
 
-    bool _save(std::shared_ptr<Land> const& land, bool force = false) const {
-        if (!land->isDirty() && !force) {
-            return true; // 没有变化，且非强制保存
+    static SaveBatch::LandEntry _captureLand(std::shared_ptr<Land> const& land) {
+        return {land, land->_getContext(), static_cast<unsigned int>(land->getDirtyCounter().getCounter())};
+    }
+    /**
+     * @brief 复制所有待保存的数据
+     * @note 调用方必须持有 mMutex(共享锁即可)，耗时仅与脏领地数量成正比；
+     *       复制会清除模板权限表与玩家设置的脏标记，并发的复制由 mCaptureMutex 串行化
+     */
+    SaveBatch _captureDirty() {
+        std::lock_guard guard(mCaptureMutex);
+        _flushLegacySettings();
+
+        SaveBatch batch;
+        batch.mJournalMark = mJournal ? mJournal->mark() : 0; // 此前记录的变更均包含在本次复制的数据中
+        if (mOperatorsDirty.exchange(false)) {
+            batch.mOperators = operators()->mList;
+        }
+        if (mLandTemplatePermTable->isDirty()) {
+            batch.mTemplatePermTable = mLandTemplatePermTable->get();
+            mLandTemplatePermTable->resetDirty();
+        }
+        batch.mPlayerSettings = mPlayerSettings.takeDirty();
+        for (auto const& land : snapshot()->mLandCache | std::views::values) {
+            if (land->isDirty()) {
+                batch.mLands.push_back(_captureLand(land));
+            }
+        }
+        return batch;
+    }
+
+    /**
+     * @brief 提交保存任务
+     * 同一时间只有一个任务在线程池上执行，执行期间提交的数据追加到队列，由该任务继续处理
+     */
+    void _submitSave(SaveBatch batch) {
+        if (batch.empty()) {
+            return;
         }
-        if (mDB->set(std::to_string(land->getId()), land->toJson().dump())) {
-            land->getDirtyCounter().reset();
+        std::lock_guard guard(mSaveMutex);
+        mSaveQueue.append(std::move(batch));
+        if (mSaveRunning) {
+            return;
+        }
+        mSaveRunning = true;
+        mSavePool->execute([this] { _drainSaveQueue(); });
+    }
+    void _drainSaveQueue() {
+        while (true) {
+            SaveBatch batch;
+            {
+                std::lock_guard guard(mSaveMutex);
+                if (mSaveQueue.empty()) {
+                    mSaveRunning = false;
+                    mSaveIdle.notify_all();
+                    return;
+                }
+                batch = std::exchange(mSaveQueue, {});
+            }
+            try {
+                _writeBatch(batch);
+            } catch (std::exception const& e) {
+                // 领地的脏计数尚未扣除，下次保存时重试
+                if (batch.mOperators) {
+                    mOperatorsDirty = true;
+                }
+                if (batch.mTemplatePermTable) {
+                    mLandTemplatePermTable->markDirty();
+                }
+                for (auto const& [shard, map] : batch.mPlayerSettings) {
+                    mPlayerSettings.markDirty(shard);
+                }
+                PLand::getInstance().getSelf().getLogger().error("保存领地数据失败: {}", e.what());
+            }
+        }
+    }
+    void _waitSaveIdle() {
+        std::unique_lock lock(mSaveMutex);
+        mSaveIdle.wait(lock, [this] { return !mSaveRunning; });
+    }
+
+    /**
+     * @brief 序列化并写入数据库
+     * 写入成功后仅扣除捕获时的脏计数，其间新增的修改留待下次保存；
+     * 全部数据写入成功后才截断变更日志，中途崩溃时由日志补齐未写入的领地(KeyValueDB 不支持原子批量写入)
+     * @note 序列化在独立的线程池上并行执行：保存任务本身运行在插件线程池上，向同一线程池投递并等待子任务可能导致死锁
+     */
+    void _writeBatch(SaveBatch const& batch) {
+        using Clock = std::chrono::steady_clock;
+
+        auto const begin = Clock::now();
+
+        std::vector<std::string> payloads(batch.mLands.size());
+        {
+            auto const sliceCount = _sliceCount(batch.mLands.size(), mEncodeWorkers);
+            auto const sliceSize  = (batch.mLands.size() + sliceCount - 1) / sliceCount;
+            _parallelFor(*mEncodePool, sliceCount, [&](size_t i) {
+                auto const first = std::min(batch.mLands.size(), i * sliceSize);
+                auto const last  = std::min(batch.mLands.size(), first + sliceSize);
+                for (auto idx = first; idx < last; ++idx) {
+                    payloads[idx] = _encodeLand(batch.mLands[idx].mContext);
+                }
+            });
+        }
+        auto const encoded = Clock::now();
+
+        size_t bytes{0};
+        size_t failed{0};
+        auto   write = [&](std::string const& key, std::string const& value) {
+            if (!mDB->set(key, value)) {
+                ++failed;
+                return false;
+            }
+            bytes += key.size() + value.size();
             return true;
+        };
+
+        if (batch.mOperators && !write(DbOperatorDataKey, json_util::struct2json(*batch.mOperators).dump())) {
+            mOperatorsDirty = true;
         }
-        return false;
+        if (batch.mTemplatePermTable
+            && !write(DbTemplatePermKey, json_util::struct2json(*batch.mTemplatePermTable).dump())) {
+            mLandTemplatePermTable->markDirty();
+        }
+        for (auto const& [shard, map] : batch.mPlayerSettings) {
+            if (!write(_playerSettingsKey(shard), json_util::struct2json(*map).dump())) {
+                mPlayerSettings.markDirty(shard);
+            }
+        }
+
+        size_t saved{0};
+        for (size_t idx = 0; idx < batch.mLands.size(); ++idx) {
+            auto const& entry = batch.mLands[idx];
+
+            std::lock_guard dbGuard(mDbWriteMutex);
+            {
+                std::shared_lock guard(mSecondaryIndexMutex);
+                if (!mOwnershipIndex.contains(*entry.mLand)) {
+                    continue; // 捕获后已被删除
+                }
+            }
+            if (write(std::to_string(entry.mContext.mLandID), payloads[idx])) {
+                entry.mLand->getDirtyCounter().consume(entry.mDirty);
+                ++saved;
+            }
+        }
+
+        auto toMs = [](std::chrono::nanoseconds ns) { return std::chrono::duration<double, std::milli>(ns).count(); };
+
+        auto& logger = PLand::getInstance().getSelf().getLogger();
+        logger.debug(
+            "已保存 {} 个领地, 写入 {} 字节, 耗时 {:.1f}ms (序列化 {:.1f}ms, 写入 {:.1f}ms)",
+            saved,
+            bytes,
+            toMs(Clock::now() - begin),
+            toMs(encoded - begin),
+            toMs(Clock::now() - encoded)
+        );
+        if (failed > 0) {
+            logger.warn("{} 项数据写入数据库失败，将在下次保存时重试", failed);
+        } else if (mJournal && batch.mJournalMark > 0) {
+            mJournal->checkpoint(batch.mJournalMark);
+        }
+    }
+
+    /**
+     * @brief 将上次运行遗留的变更日志重放到数据库
+     * @note 在加载领地前调用；重放完成后日志由新的 LandJournal 清空
+     */
+    void _replayJournal(std::filesystem::path const& file, ll::io::Logger& logger) {
+        using Op = internal::LandJournal::Op;
+
+        std::unordered_map<LandID, std::optional<LandContext>> touched; // 领地ID --> 重放后的数据(空表示已删除)
+        auto load = [&](LandID landId) -> std::optional<LandContext>& {
+            auto [iter, inserted] = touched.try_emplace(landId);
+            if (inserted) {
+                if (auto raw = mDB->get(std::to_string(landId))) {
+                    iter->second = _decodeLand(*raw);
+                }
+            }
+            return iter->second;
+        };
+
+        auto count = internal::LandJournal::replay(file, [&](internal::LandJournal::Record const& record) {
+            switch (record.mOp) {
+            case Op::Upsert:
+                touched[record.mLandId] = _decodeLand(record.mValue);
+                return;
+            case Op::Remove:
+                touched[record.mLandId] = std::nullopt;
+                return;
+            default:
+                break;
+            }
+
+            auto& context = load(record.mLandId);
+            if (!context) {
+                return; // 领地不存在或已删除
+            }
+            auto& members = context->mLandMembers;
+            switch (record.mOp) {
+            case Op::SetOwner:
+                context->mLandOwner = record.mValue;
+                break;
+            case Op::AddMember:
+                if (std::find(members.begin(), members.end(), record.mValue) == members.end()) {
+                    members.emplace_back(record.mValue);
+                }
+                break;
+            case Op::RemoveMember:
+                std::erase(members, record.mValue);
+                break;
+            case Op::SetName:
+                context->mLandName = record.mValue;
+                break;
+            case Op::Patch:
+                if (!internal::LandContextCodec::decode(record.mValue, *context)) {
+                    logger.warn("领地 {} 的变更日志记录已损坏，已跳过", record.mLandId);
+                }
+                break;
+            default:
+                break;
+            }
+        });
+        if (count == 0) {
+            return;
+        }
+
+        for (auto& [landId, context] : touched) {
+            auto key = std::to_string(landId);
+            bool ok  = true;
+            if (context) {
+                ok = mDB->set(key, _encodeLand(*context));
+            } else if (mDB->has(key)) {
+                ok = mDB->del(key);
+            }
+            if (!ok) {
+                throw std::runtime_error("Failed to replay land journal");
+            }
+        }
+        logger.warn("检测到上次未正常关闭，已重放 {} 条领地变更日志({} 个领地)", count, touched.size());
     }
 };
 
 LandID LandRegistry::_allocateNextId() { return impl->mLandIdAllocator->nextId(); }
 
+void LandRegistry::_syncIndexes(Land const& land) {
+    std::unique_lock guard(impl->mSecondaryIndexMutex);
+    if (impl->mOwnershipIndex.sync(land)) {
+        impl->mNameIndex.update(land.getId(), land.getName());
+    }
+}
+
+void LandRegistry::_journal(Land const& land, LandMutation mutation, std::string_view value) {
+    if (!impl->mJournal) {
+        return;
+    }
+    {
+        // 尚未登记的领地在 _addLand 时记录完整数据
+        std::shared_lock guard(impl->mSecondaryIndexMutex);
+        if (!impl->mOwnershipIndex.contains(land)) {
+            return;
+        }
+    }
+
+    using Op    = internal::LandJournal::Op;
+    using Codec = internal::LandContextCodec;
+
+    auto patch = [&](uint8_t groups) { impl->mJournal->append(Op::Patch, land.getId(), land._encodeFields(groups)); };
+    switch (mutation) {
+    case LandMutation::Context:
+        impl->mJournal->append(Op::Upsert, land.getId(), impl->_encodeLand(land._getContext()));
+        break;
+    case LandMutation::Range:
+        patch(Codec::Range);
+        break;
+    case LandMutation::TeleportPos:
+        patch(Codec::Teleport);
+        break;
+    case LandMutation::PermTable:
+        patch(Codec::Perms);
+        break;
+    case LandMutation::Price:
+        patch(Codec::Price);
+        break;
+    case LandMutation::Hierarchy:
+        patch(Codec::Hierarchy);
+        break;
+    case LandMutation::Identity:
+        patch(Codec::Identity);
+        break;
+    case LandMutation::Owner:
+        impl->mJournal->append(Op::SetOwner, land.getId(), value);
+        break;
+    case LandMutation::AddMember:
+        impl->mJournal->append(Op::AddMember, land.getId(), value);
+        break;
+    case LandMutation::RemoveMember:
+        impl->mJournal->append(Op::RemoveMember, land.getId(), value);
+        break;
+    case LandMutation::Name:
+        impl->mJournal->append(Op::SetName, land.getId(), value);
+        break;
+    }
+}
+
 LandRegistry::LandRegistry(PLand& mod) : impl(std::make_unique<Impl>()) {
     auto& logger = mod.getSelf().getLogger();
 
     logger.trace("打开数据库...");
     impl->_openDatabaseAndEnsureVersion(mod);
 
+    impl->mBinaryFormat = Config::cfg.storage.binaryFormat;
+    if (impl->mBinaryFormat) {
+        impl->_ensurePermLayout();
+    }
+
+    auto const journalFile = mod.getSelf().getDataDir() / internal::LandJournal::FileName;
+    impl->_replayJournal(journalFile, logger);
+    if (Config::cfg.journal.enabled) {
+        auto interval = std::chrono::milliseconds{std::max(1, Config::cfg.journal.groupCommitMs)};
+        impl->mJournal = std::make_unique<internal::LandJournal>(journalFile, interval, logger);
+    } else {
+        std::error_code ec;
+        std::filesystem::remove(journalFile, ec);
+    }
+
     auto lock = std::unique_lock<std::shared_mutex>(impl->mMutex);
     logger.info("加载管理员...");
     impl->_loadOperators(logger);
-    logger.info("已加载 {} 位管理员", impl->mLandOperators.size());
+    logger.info("已加载 {} 位管理员", impl->operators()->mList.size());
 
     logger.info("加载玩家个人设置...");
     impl->_loadPlayerSettings();
     logger.info("已加载 {} 位玩家的个人设置", impl->mPlayerSettings.size());
 
+    auto index = std::make_shared<internal::LandIndexSnapshot>();
+    index->mDimensionChunkMap = internal::LandDimensionChunkMap{{
+        .mYSection                = Config::cfg.spatialIndex.ySection,
+        .mLargeLandChunkThreshold = Config::cfg.spatialIndex.largeLandChunkThreshold,
+        .mMortonOrder             = Config::cfg.spatialIndex.mortonOrder,
+    }};
+
+    using Clock = std::chrono::steady_clock;
+
+    auto toMs = [](std::chrono::nanoseconds ns) { return std::chrono::duration<double, std::milli>(ns).count(); };
+
+    impl->mSavePool      = &mod.getThreadPool();
+    impl->mEncodeWorkers = std::max<size_t>(Impl::_workerCount(), 1);
+    impl->mEncodePool    = std::make_unique<ll::thread::ThreadPoolExecutor>("PLand-EncodePool", impl->mEncodeWorkers);
+
+    auto const loadBegin   = Clock::now();
+    auto const loadWorkers = Impl::_workerCount();
+    auto       loadPool    = ll::thread::ThreadPoolExecutor{"PLand-LoadPool", std::max<size_t>(loadWorkers, 1)};
+    auto       profile     = Impl::LoadProfile{};
+    auto       fingerprint = internal::LandIndexPersistence::Fingerprint{};
+
     logger.info("加载领地数据...");
-    impl->_loadLands();
-    logger.info("已加载 {} 个领地", impl->mLandCache.size());
+    impl->_loadLands(*index, loadPool, loadWorkers, profile, fingerprint);
+    logger.info("已加载 {} 个领地", index->mLandCache.size());
+
+    bool const lazyColdFields = Config::cfg.storage.lazyColdFields;
+    for (auto const& land : index->mLandCache | std::views::values) {
+        impl->mOwnershipIndex.add(*land);
+        impl->mNameIndex.add(land->getId(), land->getName());
+        if (lazyColdFields) {
+            land->_compact(); // 索引已持有所需数据，成员待首次访问时再展开
+        }
+    }
 
     logger.info("加载领地默认权限模板...");
     impl->_loadLandTemplatePermTable(logger);
     logger.info("领地默认权限模板加载完成");
 
-    logger.info("构建领地空间索引...");
-    impl->_buildDimensionChunkMap();
-    logger.info("领地空间索引构建完成");
+    impl->mIndexSnapshotFile = mod.getSelf().getDataDir() / internal::LandIndexPersistence::FileName;
+
+    auto begin    = Clock::now();
+    bool restored = Config::cfg.spatialIndex.persistSnapshot && impl->_restoreIndex(*index, fingerprint.value());
+    if (restored) {
+        profile.mIndex = Clock::now() - begin;
+        logger.info("已从快照恢复领地层级缓存与空间索引");
+    } else {
+        // 区块桶按嵌套层级排序，层级缓存必须先于空间索引构建
+        logger.info("构建领地层级缓存...");
+        begin                = Clock::now();
+        auto familyTreeCount = impl->_buildNestedLevelCache(*index);
+        profile.mHierarchy   = Clock::now() - begin;
+        logger.info("构建完成，共处理 {} 个领地组", familyTreeCount);
+
+        logger.info("构建领地空间索引...");
+        begin = Clock::now();
+        impl->_buildDimensionChunkMap(*index, loadPool, loadWorkers);
+        profile.mIndex = Clock::now() - begin;
+    }
+    logger.info("领地空间索引构建完成 (区块存储: {})", Config::cfg.spatialIndex.mortonOrder ? "Morton" : "Hash");
+
+    loadPool.destroy(); // 加载线程池仅用于启动阶段
+    logger.info(
+        "加载耗时 {:.1f}ms ({} 线程): 读取数据库 {:.1f}ms, 并行加载 {:.1f}ms ({} 组, {} 个领地经迁移, 累计解析 {:.1f}ms / "
+        "迁移 {:.1f}ms / 反序列化 {:.1f}ms), 层级缓存 {:.1f}ms, 空间索引 {:.1f}ms",
+        toMs(Clock::now() - loadBegin),
+        loadWorkers + 1,
+        toMs(profile.mIterate),
+        toMs(profile.mParallel),
+        profile.mSlices,
+        profile.mMigrated,
+        toMs(profile.mParse),
+        toMs(profile.mMigrate),
+        toMs(profile.mLoad),
+        toMs(profile.mHierarchy),
+        toMs(profile.mIndex)
+    );
+
+    impl->mSnapshotView.store(index.get(), std::memory_order_release);
+    impl->mSnapshot.store(std::move(index), std::memory_order_release);
 
     lock.unlock();
-    logger.info("构建领地层级缓存...");
-    {
-        std::unordered_set<std::shared_ptr<Land>> familyTreeRoot{};
-        for (auto& land : impl->mLandCache | std::views::values) {
-            if (land->isParentLand()) {
-                familyTreeRoot.insert(land);
-            }
-        }
-
-        std::stack<std::pair<std::shared_ptr<Land>, int>> stack{};
-        for (auto& root : familyTreeRoot) {
-            stack.emplace(root, 0);
-
-            while (!stack.empty()) {
-                auto [curr, level] = stack.top();
-                stack.pop();
 
-                curr->_setCachedNestedLevel(level);
-                if (curr->hasSubLand()) {
-                    for (auto& child : getLands(curr->getSubLandIDs())) {
-                        stack.emplace(child, level + 1);
-                    }
-                }
+    ll::coro::keepThis([this]() -> ll::coro::CoroTask<> {
+        while (!impl->mCoroAbort) {
+            co_await impl->mInterruptableSleep.sleepFor(std::chrono::minutes{2});
+            if (impl->mCoroAbort) {
+                break;
+            }
+            // 在服务器线程上捕获脏数据，序列化与写入交给线程池
+            Impl::SaveBatch batch;
+            {
+                std::shared_lock lock(impl->mMutex);
+                batch = impl->_captureDirty();
             }
+            impl->_submitSave(std::move(batch));
         }
-        logger.info("构建完成，共处理 {} 个领地组", familyTreeRoot.size());
-    }
+        co_return;
+    }).launch(ll::thread::ServerThreadExecutor::getDefault());
 
     ll::coro::keepThis([this]() -> ll::coro::CoroTask<> {
         while (!impl->mCoroAbort) {
-            co_await impl->mInterruptableSleep.sleepFor(std::chrono::minutes{2});
+            co_await impl->mReclaimSleep.sleepFor(ll::chrono::ticks{1});
             if (impl->mCoroAbort) {
                 break;
             }
-            save();
+            impl->_reclaimRetiredSnapshots();
         }
         co_return;
-    }).launch(mod.getThreadPool());
+    }).launch(ll::thread::ServerThreadExecutor::getDefault());
 }
 
 LandRegistry::~LandRegistry() {
     impl->mCoroAbort.store(true);
     impl->mInterruptableSleep.interrupt(true);
+    impl->mReclaimSleep.interrupt(true);
+    impl->_waitSaveIdle();
+    impl->mJournal.reset(); // 写入剩余记录并停止提交线程
+
+    if (Config::cfg.spatialIndex.persistSnapshot) {
+        std::unique_lock lock(impl->mMutex);
+        if (!impl->_persistIndex()) {
+            PLand::getInstance().getSelf().getLogger().warn("空间索引快照写入失败，下次启动将重建索引");
+        }
+    }
 }
 
 
 bool LandRegistry::isLandData(std::string_view key) {
-    return key != DbVersionKey && key != DbOperatorDataKey && key != DbPlayerSettingDataKey && key != DbTemplatePermKey;
+    return key != DbVersionKey && key != DbOperatorDataKey && key != DbTemplatePermKey
+        && !key.starts_with(DbPlayerSettingDataKey) && !key.starts_with(DbPermLayoutKey);
 }
 
 void LandRegistry::save() {
-    std::shared_lock<std::shared_mutex> lock(impl->mMutex); // 获取锁
-    impl->mDB->set(DbOperatorDataKey, json_util::struct2json(impl->mLandOperators).dump());
-
-    impl->mDB->set(DbPlayerSettingDataKey, json_util::struct2json(impl->mPlayerSettings).dump());
-
-    if (impl->mLandTemplatePermTable->isDirty()) {
-        if (impl->mDB->set(DbTemplatePermKey, json_util::struct2json(impl->mLandTemplatePermTable->get()).dump())) {
-            impl->mLandTemplatePermTable->resetDirty();
-        }
-    }
-
-    for (auto const& land : impl->mLandCache | std::views::values) {
-        (void)impl->_save(land, false);
+    Impl::SaveBatch batch;
+    {
+        std::shared_lock<std::shared_mutex> lock(impl->mMutex); // 获取锁
+        batch = impl->_captureDirty();
     }
+    impl->_submitSave(std::move(batch));
+    impl->_waitSaveIdle();
 }
 
 bool LandRegistry::save(std::shared_ptr<Land> const& land, bool force) const {
-    std::unique_lock lock(impl->mMutex); // 获取锁
-    return impl->_save(land, force);
+    if (!land->isDirty() && !force) {
+        return true; // 没有变化，且非强制保存
+    }
+    Impl::SaveBatch batch;
+    {
+        std::shared_lock<std::shared_mutex> lock(impl->mMutex); // 获取锁
+        auto registered = impl->snapshot()->mLandCache.find(land->getId());
+        if (!registered || *registered != land) {
+            return false; // 未登记的领地不会被写入
+        }
+        batch.mLands.push_back(Impl::_captureLand(land));
+    }
+    impl->_submitSave(std::move(batch));
+    return true;
 }
 
 
 bool LandRegistry::isOperator(mce::UUID const& uuid) const {
-    std::shared_lock<std::shared_mutex> lock(impl->mMutex);
-    return std::find(impl->mLandOperators.begin(), impl->mLandOperators.end(), uuid) != impl->mLandOperators.end();
+    auto operators = impl->operators();
+    return !operators->mSet.empty() && operators->mSet.contains(uuid); // 无操作员时无需计算哈希
 }
 bool LandRegistry::addOperator(mce::UUID const& uuid) {
-    if (isOperator(uuid)) {
+    std::unique_lock<std::shared_mutex> lock(impl->mMutex); // 获取锁
+    auto operators = impl->operators();
+    if (operators->mSet.contains(uuid)) {
         return false;
     }
-    std::unique_lock<std::shared_mutex> lock(impl->mMutex); // 获取锁
-    impl->mLandOperators.push_back(uuid);
+    auto list = operators->mList;
+    list.push_back(uuid);
+    impl->_publishOperators(std::move(list));
+    impl->mOperatorsDirty = true;
     return true;
 }
 bool LandRegistry::removeOperator(mce::UUID const& uuid) {
     std::unique_lock<std::shared_mutex> lock(impl->mMutex); // 获取锁
-
-    auto iter = std::find(impl->mLandOperators.begin(), impl->mLandOperators.end(), uuid);
-    if (iter == impl->mLandOperators.end()) {
+    auto operators = impl->operators();
+    if (!operators->mSet.contains(uuid)) {
         return false;
     }
-    impl->mLandOperators.erase(iter);
+    auto list = operators->mList;
+    std::erase(list, uuid);
+    impl->_publishOperators(std::move(list));
+    impl->mOperatorsDirty = true;
     return true;
 }
-std::vector<mce::UUID> const& LandRegistry::getOperators() const {
-    std::shared_lock<std::shared_mutex> lock(impl->mMutex);
-    return impl->mLandOperators;
+std::vector<mce::UUID> LandRegistry::getOperators() const {
+    return impl->operators()->mList;
 }
+uint64_t LandRegistry::getOperatorsVersion() const { return impl->mOperatorsVersion.load(std::memory_order_acquire); }
 
 
-PlayerSettings& LandRegistry::getOrCreatePlayerSettings(mce::UUID const& uuid) {
-    std::shared_lock<std::shared_mutex> lock(impl->mMutex);
+PlayerSettings LandRegistry::getPlayerSettings(mce::UUID const& uuid) const { return impl->mPlayerSettings.get(uuid); }
+
+void LandRegistry::setPlayerSettings(mce::UUID const& uuid, PlayerSettings const& settings) {
+    impl->mPlayerSettings.set(uuid, settings);
+}
 
-    auto iter = impl->mPlayerSettings.find(uuid);
-    if (iter == impl->mPlayerSettings.end()) {
-        iter = impl->mPlayerSettings.emplace(uuid, PlayerSettings{}).first;
+PlayerSettings& LandRegistry::getOrCreatePlayerSettings(mce::UUID const& uuid) {
+    std::lock_guard guard(impl->mLegacySettingsMutex);
+
+    auto& entry = impl->mLegacySettings[uuid];
+    if (!entry) {
+        entry = std::make_unique<Impl::LegacySettings>();
+        entry->mValue = entry->mSynced = impl->mPlayerSettings.get(uuid);
+    } else {
+        impl->_syncLegacySettings(uuid, *entry);
     }
-    return iter->second;
+    return entry->mValue;
 }
 
 LandTemplatePermTable& LandRegistry::getLandTemplatePermTable() const { return *impl->mLandTemplatePermTable; }
 
-bool LandRegistry::hasLand(LandID id) const {
-    std::shared_lock<std::shared_mutex> lock(impl->mMutex);
-    return impl->mLandCache.find(id) != impl->mLandCache.end();
-}
+bool LandRegistry::hasLand(LandID id) const { return impl->snapshot()->mLandCache.contains(id); }
 
 void LandRegistry::refreshLandRange(std::shared_ptr<Land> const& ptr) {
     std::unique_lock<std::shared_mutex> lock(impl->mMutex);
-    impl->mDimensionChunkMap.refreshRange(ptr);
+
+    auto next = impl->_beginWrite();
+    next->mDimensionChunkMap.refreshRange(ptr);
+    impl->_publish(std::move(next));
+}
+void LandRegistry::refreshLandLevels(std::vector<std::shared_ptr<Land>> const& lands) {
+    if (lands.empty()) {
+        return;
+    }
+    std::unique_lock<std::shared_mutex> lock(impl->mMutex);
+
+    auto next = impl->_beginWrite();
+    for (auto& land : lands) {
+        next->mDimensionChunkMap.refreshLevel(land);
+    }
+    impl->_publish(std::move(next));
 }
 
 ll::Expected<> LandRegistry::addOrdinaryLand(std::shared_ptr<Land> const& land) {
@@ -412,7 +1415,15 @@ ll::Expected<> LandRegistry::addOrdinaryLand(std::shared_ptr<Land> const& land)
         || !LandCreateValidator::isOrdinaryLandRangeConflict(*this, land)) {
         return StorageError::make(StorageError::ErrorCode::LandRangeIllegal, "The land range is illegal");
     }
-    return impl->_addLand(land);
+
+    std::unique_lock lock(impl->mMutex); // 获取锁
+
+    auto next = impl->_beginWrite();
+    if (auto res = impl->_addLand(*next, land); !res) {
+        return res;
+    }
+    impl->_publish(std::move(next));
+    return {};
 }
 ll::Expected<> LandRegistry::removeOrdinaryLand(std::shared_ptr<Land> const& ptr) {
     if (!ptr->isOrdinaryLand()) {
@@ -423,7 +1434,13 @@ ll::Expected<> LandRegistry::removeOrdinaryLand(std::shared_ptr<Land> const& ptr
     }
 
     std::unique_lock lock(impl->mMutex); // 获取锁
-    return impl->_removeLand(ptr);
+
+    auto next = impl->_beginWrite();
+    if (auto res = impl->_removeLand(*next, ptr); !res) {
+        return res;
+    }
+    impl->_publish(std::move(next));
+    return {};
 }
 
 ll::Expected<> LandRegistry::executeTransaction(
@@ -455,14 +1472,25 @@ ll::Expected<> LandRegistry::executeTransaction(
         for (auto& land : participants) {
             auto snapshot = snapshots[land.get()];
             land->_reinit(std::move(snapshot.context), snapshot.dirtyCount);
+            _syncIndexes(*land); // 回滚可能还原主人、成员与名称
+            _journal(*land, LandMutation::Context, {}); // 覆盖事务中已记录的变更
         }
         return StorageError::make(StorageError::ErrorCode::TransactionError, "Transaction aborted.");
     }
 
     // === 提交 (Commit) ===
+    std::shared_ptr<internal::LandIndexSnapshot> next{nullptr}; // 仅在索引发生变化时复制快照
+    auto ensureNext = [&]() -> internal::LandIndexSnapshot& {
+        if (!next) next = impl->_beginWrite();
+        return *next;
+    };
+    auto publishNext = [&]() {
+        if (next) impl->_publish(std::move(next));
+    };
+
     for (auto& land : participants) {
         if (ctx.mLandsToRemove.contains(land->getId())) {
-            if (auto res = impl->_removeLand(land); !res) {
+            if (auto res = impl->_removeLand(ensureNext(), land); !res) {
                 PLand::getInstance().getSelf().getLogger().error("Failed to remove land during commit!");
             }
             continue;
@@ -477,94 +1505,170 @@ ll::Expected<> LandRegistry::executeTransaction(
         if (justAllocated) {
             // 新领地，直接入库
             // 注意：_addLand 内部不要再分配 ID 了，因为已经分过了
-            if (auto res = impl->_addLand(land, false /* don't allocate id */); !res) {
+            if (auto res = impl->_addLand(ensureNext(), land, false /* don't allocate id */); !res) {
+                publishNext(); // 已提交的部分照常生效
                 return res;
             }
         } else if (land->isDirty()) {
-            (void)impl->_save(land, false);
+            if (impl->mJournal) {
+                // 事务内通过 setter 的修改已各自记录，直接修改的只有父子关系
+                _journal(*land, LandMutation::Hierarchy, {}); // 变更已持久化到日志，由自动保存写入数据库
+                continue;
+            }
+            Impl::SaveBatch batch;
+            batch.mLands.push_back(Impl::_captureLand(land));
+            impl->_submitSave(std::move(batch));
         }
     }
+    publishNext();
     return {};
 }
 
 std::shared_ptr<Land> LandRegistry::getLand(LandID id) const {
-    std::shared_lock lock(impl->mMutex);
+    auto snapshot = impl->snapshot();
 
-    auto landIt = impl->mLandCache.find(id);
-    if (landIt != impl->mLandCache.end()) {
-        return landIt->second;
-    }
-    return nullptr;
+    auto land = snapshot->mLandCache.find(id);
+    return land ? *land : nullptr;
 }
 std::vector<std::shared_ptr<Land>> LandRegistry::getLands() const {
-    std::shared_lock lock(impl->mMutex);
+    auto snapshot = impl->snapshot();
 
     std::vector<std::shared_ptr<Land>> lands;
-    lands.reserve(impl->mLandCache.size());
-    for (auto& land : impl->mLandCache) {
+    lands.reserve(snapshot->mLandCache.size());
+    for (auto& land : snapshot->mLandCache) {
         lands.push_back(land.second);
     }
     return lands;
 }
 std::vector<std::shared_ptr<Land>> LandRegistry::getLands(std::vector<LandID> const& ids) const {
-    std::shared_lock lock(impl->mMutex);
+    auto snapshot = impl->snapshot();
 
     std::vector<std::shared_ptr<Land>> lands;
     for (auto id : ids) {
-        if (auto iter = impl->mLandCache.find(id); iter != impl->mLandCache.end()) {
-            lands.push_back(iter->second);
+        if (auto land = snapshot->mLandCache.find(id)) {
+            lands.push_back(*land);
         }
     }
     return lands;
 }
 std::vector<std::shared_ptr<Land>> LandRegistry::getLands(LandDimid dimid) const {
-    std::shared_lock lock(impl->mMutex);
+    auto snapshot = impl->snapshot();
 
     std::vector<std::shared_ptr<Land>> lands;
-    for (auto& land : impl->mLandCache) {
-        if (land.second->getDimensionId() == dimid) {
-            lands.push_back(land.second);
-        }
+
+    std::shared_lock guard(impl->mSecondaryIndexMutex);
+    if (auto ids = impl->mOwnershipIndex.findInDimension(dimid)) {
+        Impl::_collectLands(*snapshot, *ids, lands);
     }
     return lands;
 }
 std::vector<std::shared_ptr<Land>> LandRegistry::getLands(mce::UUID const& uuid, bool includeShared) const {
-    std::shared_lock lock(impl->mMutex);
+    auto snapshot = impl->snapshot();
 
     std::vector<std::shared_ptr<Land>> lands;
-    for (auto& land : impl->mLandCache) {
-        if (land.second->isOwner(uuid) || (includeShared && land.second->isMember(uuid))) {
-            lands.push_back(land.second);
+
+    std::shared_lock guard(impl->mSecondaryIndexMutex);
+    auto             owned = impl->mOwnershipIndex.findOwned(uuid);
+    if (owned) {
+        Impl::_collectLands(*snapshot, *owned, lands);
+    }
+    if (includeShared) {
+        if (auto shared = impl->mOwnershipIndex.findShared(uuid)) {
+            Impl::_collectLands(*snapshot, *shared, lands, owned);
         }
     }
     return lands;
 }
 std::vector<std::shared_ptr<Land>> LandRegistry::getLands(mce::UUID const& uuid, LandDimid dimid) const {
-    std::shared_lock lock(impl->mMutex);
+    auto snapshot = impl->snapshot();
 
     std::vector<std::shared_ptr<Land>> lands;
-    for (auto& land : impl->mLandCache) {
-        if (land.second->getDimensionId() == dimid && land.second->isOwner(uuid)) {
-            lands.push_back(land.second);
-        }
+
+    std::shared_lock guard(impl->mSecondaryIndexMutex);
+    if (auto owned = impl->mOwnershipIndex.findOwned(uuid)) {
+        Impl::_collectLands(*snapshot, *owned, lands);
+        std::erase_if(lands, [dimid](auto const& land) { return land->getDimensionId() != dimid; });
     }
     return lands;
 }
 std::unordered_map<mce::UUID, std::unordered_set<std::shared_ptr<Land>>> LandRegistry::getLandsByOwner() const {
-    std::shared_lock lock(impl->mMutex);
+    auto snapshot = impl->snapshot();
 
     std::unordered_map<mce::UUID, std::unordered_set<std::shared_ptr<Land>>> lands;
-    for (const auto& ptr : impl->mLandCache | std::views::values) {
-        auto& owner = ptr->getOwner();
-        lands[owner].insert(ptr);
+
+    std::shared_lock guard(impl->mSecondaryIndexMutex);
+    for (auto const& [owner, ids] : impl->mOwnershipIndex.getOwnedMap()) {
+        auto& set = lands[owner];
+        set.reserve(ids.size());
+        for (auto id : ids) {
+            if (auto land = snapshot->mLandCache.find(id)) {
+                set.insert(*land);
+            }
+        }
     }
     return lands;
 }
 
+size_t LandRegistry::getLandCount(mce::UUID const& uuid, bool includeShared) const {
+    std::shared_lock guard(impl->mSecondaryIndexMutex);
 
-LandPermType LandRegistry::getPermType(mce::UUID const& uuid, LandID id, bool includeOperator) const {
-    std::shared_lock lock(impl->mMutex);
+    auto   owned = impl->mOwnershipIndex.findOwned(uuid);
+    size_t count = owned ? owned->size() : 0;
+    if (includeShared) {
+        if (auto shared = impl->mOwnershipIndex.findShared(uuid)) {
+            for (auto id : *shared) {
+                count += owned && owned->contains(id) ? 0 : 1;
+            }
+        }
+    }
+    return count;
+}
+size_t LandRegistry::getLandCount(LandDimid dimid) const {
+    std::shared_lock guard(impl->mSecondaryIndexMutex);
+
+    auto ids = impl->mOwnershipIndex.findInDimension(dimid);
+    return ids ? ids->size() : 0;
+}
+std::unordered_map<mce::UUID, size_t> LandRegistry::getLandCountByOwner() const {
+    std::shared_lock guard(impl->mSecondaryIndexMutex);
 
+    std::unordered_map<mce::UUID, size_t> counts;
+    counts.reserve(impl->mOwnershipIndex.getOwnedMap().size());
+    for (auto const& [owner, ids] : impl->mOwnershipIndex.getOwnedMap()) {
+        counts.emplace(owner, ids.size());
+    }
+    return counts;
+}
+LandRegistry::NameSearchResult LandRegistry::searchLandsByName(
+    std::string_view    keyword,
+    size_t              offset,
+    size_t              limit,
+    CustomFilter const& filter
+) const {
+    auto snapshot = impl->snapshot();
+
+    std::shared_lock guard(impl->mSecondaryIndexMutex);
+
+    auto result = impl->mNameIndex.search(keyword, offset, limit, Impl::_nameFilter(*snapshot, filter));
+    return {std::move(result.mIds), result.mTotal};
+}
+LandRegistry::NameSearchResult LandRegistry::searchLandsByName(
+    std::vector<LandID> const& scope,
+    std::string_view           keyword,
+    size_t                     offset,
+    size_t                     limit,
+    CustomFilter const&        filter
+) const {
+    auto snapshot = impl->snapshot();
+
+    std::shared_lock guard(impl->mSecondaryIndexMutex);
+
+    auto result = impl->mNameIndex.searchIn(scope, keyword, offset, limit, Impl::_nameFilter(*snapshot, filter));
+    return {std::move(result.mIds), result.mTotal};
+}
+
+
+LandPermType LandRegistry::getPermType(mce::UUID const& uuid, LandID id, bool includeOperator) const {
     if (includeOperator && isOperator(uuid)) return LandPermType::Operator;
 
     if (auto land = getLand(id); land) {
@@ -576,128 +1680,129 @@ LandPermType LandRegistry::getPermType(mce::UUID const& uuid, LandID id, bool in
 
 
 std::shared_ptr<Land> LandRegistry::getLandAt(BlockPos const& pos, LandDimid dimid) const {
-    std::shared_lock<std::shared_mutex>       lock(impl->mMutex);
-    std::unordered_set<std::shared_ptr<Land>> result;
-
-    auto landsIds = impl->mDimensionChunkMap.queryLand(dimid, internal::ChunkEncoder::encode(pos.x >> 4, pos.z >> 4));
-    if (!landsIds) {
-        return nullptr;
+    auto snapshot = impl->snapshot();
+    if (auto land = internal::LandPointQuery::queryAt(*snapshot, pos, dimid)) {
+        return *land;
     }
-
-    for (auto const& id : *landsIds) {
-        if (auto iter = impl->mLandCache.find(id); iter != impl->mLandCache.end()) {
-            if (auto const& land = iter->second; land->getAABB().hasPos(pos, land->is3D())) {
-                result.insert(land);
-            }
+    return nullptr;
+}
+void LandRegistry::findLandsAt(
+    std::span<BlockPos const> positions,
+    LandDimid                 dimid,
+    std::span<Land const*>    out
+) const {
+    assert(out.size() >= positions.size());
+    auto snapshot = impl->mSnapshotView.load(std::memory_order_acquire);
+
+    // 按区块对下标排序，同一区块内的坐标共享区块桶与大型领地候选
+    // 下标缓冲区按线程复用，批量大小超过上次的最大值时才分配
+    thread_local std::vector<uint32_t> order;
+    order.resize(positions.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        auto const& pa = positions[a];
+        auto const& pb = positions[b];
+        return std::pair{pa.x >> 4, pa.z >> 4} < std::pair{pb.x >> 4, pb.z >> 4};
+    });
+
+    std::optional<internal::LandPointQuery::ChunkContext> ctx;
+    for (auto idx : order) {
+        auto const& pos    = positions[idx];
+        int const   chunkX = pos.x >> 4;
+        int const   chunkZ = pos.z >> 4;
+        if (!ctx || ctx->mChunkX != chunkX || ctx->mChunkZ != chunkZ) {
+            ctx = internal::LandPointQuery::prepareChunk(*snapshot, dimid, chunkX, chunkZ);
         }
+        auto land = internal::LandPointQuery::queryInChunk(*snapshot, *ctx, pos, dimid);
+        out[idx]  = land ? land->get() : nullptr;
     }
-
-    if (!result.empty()) {
-        if (result.size() == 1) {
-            return *result.begin(); // 只有一个领地，即普通领地
-        }
-
-        // 子领地优先级最高
-        std::shared_ptr<Land> deepestLand = nullptr;
-        int                   maxLevel    = -1;
-        for (auto& land : result) {
-            int currentLevel = land->getNestedLevel();
-            if (currentLevel > maxLevel) {
-                maxLevel    = currentLevel;
-                deepestLand = land;
-            }
-        }
-        return deepestLand;
+}
+Land const* LandRegistry::findLandAt(BlockPos const& pos, LandDimid dimid) const {
+    // 借用当前快照的裸指针: 快照退役后至少保留到下一 tick 结束，因此服务器线程内无需持有引用计数
+    auto snapshot = impl->mSnapshotView.load(std::memory_order_acquire);
+    if (auto land = internal::LandPointQuery::queryAt(*snapshot, pos, dimid)) {
+        return land->get();
     }
-
     return nullptr;
 }
+bool LandRegistry::hasLandInChunk(int chunkX, int chunkZ, LandDimid dimid) const {
+    return impl->snapshot()->mDimensionChunkMap.isChunkOccupied(dimid, chunkX, chunkZ);
+}
+uint64_t LandRegistry::getGeneration() const { return impl->mGeneration.load(std::memory_order_acquire); }
 std::unordered_set<std::shared_ptr<Land>>
 LandRegistry::getLandAt(BlockPos const& center, int radius, LandDimid dimid) const {
-    std::shared_lock<std::shared_mutex> lock(impl->mMutex);
-
-    if (!impl->mDimensionChunkMap.hasDimension(dimid)) {
-        return {};
-    }
-
-    std::unordered_set<internal::ChunkID>     visitedChunks; // 记录已访问的区块
     std::unordered_set<std::shared_ptr<Land>> lands;
-
-    int minChunkX = (center.x - radius) >> 4;
-    int minChunkZ = (center.z - radius) >> 4;
-    int maxChunkX = (center.x + radius) >> 4;
-    int maxChunkZ = (center.z + radius) >> 4;
-
-    for (int x = minChunkX; x <= maxChunkX; ++x) {
-        for (int z = minChunkZ; z <= maxChunkZ; ++z) {
-            internal::ChunkID chunkId = internal::ChunkEncoder::encode(x, z);
-            if (visitedChunks.find(chunkId) != visitedChunks.end()) {
-                continue; // 如果区块已经访问过，则跳过
-            }
-            visitedChunks.insert(chunkId);
-
-            auto landsIds = impl->mDimensionChunkMap.queryLand(dimid, chunkId);
-            if (!landsIds) {
-                continue;
-            }
-
-            for (auto const& id : *landsIds) {
-                if (auto iter = impl->mLandCache.find(id); iter != impl->mLandCache.end()) {
-                    if (auto const& land = iter->second; land->isCollision(center, radius)) {
-                        lands.insert(land);
-                    }
-                }
-            }
-        }
-    }
+    forEachLandIn(center, radius, dimid, [&](std::shared_ptr<Land> const& land) {
+        lands.insert(land);
+        return true;
+    });
     return lands;
 }
 std::unordered_set<std::shared_ptr<Land>>
 LandRegistry::getLandAt(BlockPos const& pos1, BlockPos const& pos2, LandDimid dimid) const {
-    std::shared_lock<std::shared_mutex> lock(impl->mMutex);
-
-    if (!impl->mDimensionChunkMap.hasDimension(dimid)) {
-        return {};
-    }
-
-    std::unordered_set<internal::ChunkID>     visitedChunks;
     std::unordered_set<std::shared_ptr<Land>> lands;
 
-    int minChunkX = std::min(pos1.x, pos2.x) >> 4;
-    int minChunkZ = std::min(pos1.z, pos2.z) >> 4;
-    int maxChunkX = std::max(pos1.x, pos2.x) >> 4;
-    int maxChunkZ = std::max(pos1.z, pos2.z) >> 4;
-
-    for (int x = minChunkX; x <= maxChunkX; ++x) {
-        for (int z = minChunkZ; z <= maxChunkZ; ++z) {
-            internal::ChunkID chunkId = internal::ChunkEncoder::encode(x, z);
-            if (visitedChunks.find(chunkId) != visitedChunks.end()) {
-                continue;
-            }
-            visitedChunks.insert(chunkId);
+    auto range = LandAABB::make(LandPos::make(pos1), LandPos::make(pos2));
+    forEachLandIn(range, dimid, [&](std::shared_ptr<Land> const& land) {
+        lands.insert(land);
+        return true;
+    });
+    return lands;
+}
 
-            auto landsIds = impl->mDimensionChunkMap.queryLand(dimid, chunkId);
-            if (!landsIds) {
-                continue;
+void LandRegistry::forEachLandIn(LandAABB const& range, LandDimid dimid, LandVisitor const& visitor) const {
+    auto snapshot = impl->snapshot();
+
+    auto const pos1 = range.min.as();
+    auto const pos2 = range.max.as();
+    snapshot->mDimensionChunkMap.forEachLandIn(
+        dimid,
+        range.min.x >> 4,
+        range.max.x >> 4,
+        range.min.z >> 4,
+        range.max.z >> 4,
+        range.min.y >> 4,
+        range.max.y >> 4,
+        [&](LandID id) {
+            auto land = snapshot->mLandCache.find(id);
+            if (!land || !(*land)->isCollision(pos1, pos2)) {
+                return true;
             }
-
-            for (auto const& id : *landsIds) {
-                if (auto iter = impl->mLandCache.find(id); iter != impl->mLandCache.end()) {
-                    if (auto const& land = iter->second; land->isCollision(pos1, pos2)) {
-                        lands.insert(land);
-                    }
-                }
+            return visitor(*land);
+        }
+    );
+}
+void LandRegistry::forEachLandIn(
+    BlockPos const&    center,
+    int                radius,
+    LandDimid          dimid,
+    LandVisitor const& visitor
+) const {
+    auto snapshot = impl->snapshot();
+
+    snapshot->mDimensionChunkMap.forEachLandIn(
+        dimid,
+        (center.x - radius) >> 4,
+        (center.x + radius) >> 4,
+        (center.z - radius) >> 4,
+        (center.z + radius) >> 4,
+        (center.y - radius) >> 4,
+        (center.y + radius) >> 4,
+        [&](LandID id) {
+            auto land = snapshot->mLandCache.find(id);
+            if (!land || !(*land)->isCollision(center, radius)) {
+                return true;
             }
+            return visitor(*land);
         }
-    }
-    return lands;
+    );
 }
 
 std::vector<std::shared_ptr<Land>> LandRegistry::getLandsWhere(CustomFilter const& filter) const {
-    std::shared_lock<std::shared_mutex> lock(impl->mMutex);
+    auto snapshot = impl->snapshot();
 
     std::vector<std::shared_ptr<Land>> result;
-    for (auto const& [id, land] : impl->mLandCache) {
+    for (auto const& [id, land] : snapshot->mLandCache) {
         if (filter(land)) {
             result.push_back(land);
         }
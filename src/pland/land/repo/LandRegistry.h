@@ -1,7 +1,10 @@
 #pragma once
 #include "pland/Global.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string_view>
 #include <unordered_map>
 #include <unordered_set>
@@ -17,43 +20,104 @@ class UUID;
 namespace land {
 
 class Land;
+class LandAABB;
 class LandContext;
 class PLand;
 
 struct PlayerSettings {
     bool showEnterLandTitle{true};     // 是否显示进入领地提示
     bool showBottomContinuedTip{true}; // 是否持续显示底部提示
+
+    bool operator==(PlayerSettings const&) const = default;
 };
 
 class LandTemplatePermTable;
 
+/**
+ * @brief 领地变更类型(变更日志)
+ */
+enum class LandMutation : uint8_t {
+    Context,      // 完整数据(创建、回滚)
+    Owner,        // 主人
+    AddMember,    // 添加成员
+    RemoveMember, // 移除成员
+    Name,         // 名称
+    Range,        // 领地范围
+    TeleportPos,  // 传送点
+    PermTable,    // 权限表
+    Price,        // 原始购买价格
+    Hierarchy,    // 父领地、子领地
+    Identity,     // 主人与标记(数据转换)
+};
+
 class LandRegistry final {
     struct Impl;
     std::unique_ptr<Impl> impl;
 
     friend class TransactionContext;
+    friend class Land;
 
     LandID _allocateNextId();
 
+    void _syncIndexes(Land const& land); // 领地主人/成员/名称变更后同步二级索引
+
+    void _journal(Land const& land, LandMutation mutation, std::string_view value); // 记录领地变更日志
+
 public:
     LD_DISABLE_COPY_AND_MOVE(LandRegistry);
     explicit LandRegistry(PLand& mod);
     ~LandRegistry();
 
+    /**
+     * @brief 保存所有变更并等待写入完成
+     * @note 仅在复制脏数据时短暂持有锁，序列化与写入在线程池上进行
+     */
     LDAPI void save();
 
+    /**
+     * @brief 异步保存单个领地
+     * @return 领地无需保存或已提交保存时返回 true，领地未登记时返回 false
+     * @note 返回值不代表写入结果：写入在后台完成，失败时领地保持为脏，由下次保存重试
+     */
     LDAPI bool save(std::shared_ptr<Land> const& land, bool force = false) const;
 
 public:
+    /**
+     * @brief 查询玩家是否为领地操作员
+     * @note 无锁，O(1)，任意线程可调用
+     */
     LDNDAPI bool isOperator(mce::UUID const& uuid) const;
 
     LDNDAPI bool addOperator(mce::UUID const& uuid);
 
     LDNDAPI bool removeOperator(mce::UUID const& uuid);
 
-    LDNDAPI std::vector<mce::UUID> const& getOperators() const;
+    LDNDAPI std::vector<mce::UUID> getOperators() const;
+
+    /**
+     * @brief 获取操作员列表版本
+     * @note 每次添加或移除操作员后递增，可用于判断调用方缓存的操作员身份是否过期
+     */
+    LDNDAPI uint64_t getOperatorsVersion() const;
+
+    /**
+     * @brief 获取玩家设置
+     * @note 无锁，未设置过的玩家返回默认设置
+     */
+    LDNDAPI PlayerSettings getPlayerSettings(mce::UUID const& uuid) const;
+
+    /**
+     * @brief 修改玩家设置，下次保存时写回所在分片
+     */
+    LDAPI void setPlayerSettings(mce::UUID const& uuid, PlayerSettings const& settings);
 
-    LDNDAPI PlayerSettings& getOrCreatePlayerSettings(mce::UUID const& uuid);
+    /**
+     * @brief 获取玩家设置的可变引用(兼容旧接口)
+     * @note 对引用的修改在下次调用本接口或下次保存时写回设置存储
+     * @warning 仅限服务器线程调用
+     */
+    [[deprecated("Use getPlayerSettings() / setPlayerSettings() instead.")]] LDNDAPI PlayerSettings&
+    getOrCreatePlayerSettings(mce::UUID const& uuid);
 
     LDNDAPI LandTemplatePermTable& getLandTemplatePermTable() const;
 
@@ -61,6 +125,8 @@ class LandRegistry final {
 
     LDAPI void refreshLandRange(std::shared_ptr<Land> const& ptr); // 刷新领地范围
 
+    LDAPI void refreshLandLevels(std::vector<std::shared_ptr<Land>> const& lands); // 刷新领地层级
+
     LDNDAPI ll::Expected<> addOrdinaryLand(std::shared_ptr<Land> const& land);
 
     LDNDAPI ll::Expected<> removeOrdinaryLand(std::shared_ptr<Land> const& ptr);
@@ -94,25 +160,121 @@ class LandRegistry final {
 
     LDNDAPI std::unordered_map<mce::UUID, std::unordered_set<std::shared_ptr<Land>>> getLandsByOwner() const;
 
+    /**
+     * @brief 获取玩家的领地数量
+     * @param includeShared 是否包含玩家作为成员的领地
+     * @note 基于归属索引计数，不遍历全部领地
+     */
+    LDNDAPI size_t getLandCount(mce::UUID const& uuid, bool includeShared = false) const;
+
+    /**
+     * @brief 获取维度内的领地数量
+     */
+    LDNDAPI size_t getLandCount(LandDimid dimid) const;
+
+    /**
+     * @brief 获取每位主人名下的领地数量
+     */
+    LDNDAPI std::unordered_map<mce::UUID, size_t> getLandCountByOwner() const;
+
+    using CustomFilter = std::function<bool(std::shared_ptr<Land> const&)>;
+
+    struct NameSearchResult {
+        std::vector<LandID> mIds;      // 当前页的领地ID(按相关度排序)
+        size_t              mTotal{0}; // 匹配总数(已应用过滤条件)
+    };
+
+    /**
+     * @brief 按名称搜索领地(不区分 ASCII 大小写)
+     * @note 基于三元组倒排索引，结果按 完全匹配 > 前缀匹配 > 子串匹配 排序
+     * @param offset 跳过的结果数量
+     * @param limit 返回的最大结果数量(分页展示时传入每页数量)
+     * @param filter 额外过滤条件，仅对名称命中的领地求值
+     */
+    LDNDAPI NameSearchResult searchLandsByName(
+        std::string_view    keyword,
+        size_t              offset = 0,
+        size_t              limit  = SIZE_MAX,
+        CustomFilter const& filter = {}
+    ) const;
+
+    /**
+     * @brief 在给定领地范围内按名称搜索(如玩家自己的领地)
+     * @note 只校验 scope 内领地的名称，不扫描全局倒排表；排序与分页规则同上
+     */
+    LDNDAPI NameSearchResult searchLandsByName(
+        std::vector<LandID> const& scope,
+        std::string_view           keyword,
+        size_t                     offset = 0,
+        size_t                     limit  = SIZE_MAX,
+        CustomFilter const&        filter = {}
+    ) const;
+
     LDNDAPI LandPermType getPermType(mce::UUID const& uuid, LandID id = 0, bool includeOperator = true) const;
 
     LDNDAPI std::shared_ptr<Land> getLandAt(BlockPos const& pos, LandDimid dimid) const;
 
+    /**
+     * @brief 查询坐标所在的领地(借用语义)
+     * @note 不分配内存、不产生引用计数开销，用于事件拦截等热路径
+     * @warning 仅限服务器线程调用；返回的指针仅在当前 tick 内有效，禁止跨 tick 保存
+     */
+    LDNDAPI Land const* findLandAt(BlockPos const& pos, LandDimid dimid) const;
+
+    /**
+     * @brief 批量查询坐标所在的领地(借用语义)
+     * @param positions 同一维度下的坐标
+     * @param out 查询结果，与 positions 一一对应(大小不得小于 positions)
+     * @note 仅加载一次快照，并按区块分组复用区块桶查询
+     * @warning 同 findLandAt，仅限服务器线程调用，结果仅在当前 tick 内有效
+     */
+    LDAPI void findLandsAt(std::span<BlockPos const> positions, LandDimid dimid, std::span<Land const*> out) const;
+
+    /**
+     * @brief 查询区块内是否存在任意领地
+     * @note 用于判断荒野区块，区块内存在领地时坐标本身仍可能不在领地内
+     */
+    LDNDAPI bool hasLandInChunk(int chunkX, int chunkZ, LandDimid dimid) const;
+
+    /**
+     * @brief 获取领地索引代数
+     * @note 索引每次变更(增删领地、范围或层级变化)后递增，可用于判断调用方缓存的查询结果是否过期
+     */
+    LDNDAPI uint64_t getGeneration() const;
+
     LDNDAPI std::unordered_set<std::shared_ptr<Land>>
             getLandAt(BlockPos const& center, int radius, LandDimid dimid) const;
 
     LDNDAPI std::unordered_set<std::shared_ptr<Land>>
             getLandAt(BlockPos const& pos1, BlockPos const& pos2, LandDimid dimid) const;
 
-    using CustomFilter = std::function<bool(std::shared_ptr<Land> const&)>;
+    /**
+     * @brief 领地访问器
+     * @return 返回 false 停止遍历
+     */
+    using LandVisitor = std::function<bool(std::shared_ptr<Land> const&)>;
+
+    /**
+     * @brief 遍历与范围相交的所有领地
+     * @note 不构造中间容器，每个领地仅回调一次
+     */
+    LDAPI void forEachLandIn(LandAABB const& range, LandDimid dimid, LandVisitor const& visitor) const;
+
+    /**
+     * @brief 遍历与 center 为中心、radius 为半径的方形范围相交的所有领地
+     * @note 不构造中间容器，每个领地仅回调一次
+     */
+    LDAPI void forEachLandIn(BlockPos const& center, int radius, LandDimid dimid, LandVisitor const& visitor) const;
+
     LDNDAPI std::vector<std::shared_ptr<Land>> getLandsWhere(CustomFilter const& filter) const;
 
 public:
     static constexpr auto DbDirName              = "db";              // 数据库目录名
     static constexpr auto DbVersionKey           = "__version__";     // 数据库版本键
     static constexpr auto DbOperatorDataKey      = "operators";       // 操作员数据键
-    static constexpr auto DbPlayerSettingDataKey = "player_settings"; // 玩家设置数据键
+    static constexpr auto DbPlayerSettingDataKey = "player_settings"; // 玩家设置数据键(前缀，按分片存储)
     static constexpr auto DbTemplatePermKey      = "template_perm";   // 领地模板权限表数据键
+    static constexpr auto DbPermLayoutKey        = "__perm_layout_";  // 二进制领地数据权限表位序键(前缀，按结构版本存储)
     static bool           isLandData(std::string_view key);           // 判断键是否为领地数据键
 };
 
@@ -0,0 +1,184 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace land::internal {
+
+
+/**
+ * @brief 二进制写入器
+ * @note 定长数值按本机字节序写入，仅用于本机生成、本机读取的缓存文件；变长整数与字节序无关，
+ *       需要跨平台的定长数值使用 writeLittleEndian
+ */
+class BinaryWriter {
+    std::string& mBuffer;
+
+public:
+    explicit BinaryWriter(std::string& buffer) : mBuffer(buffer) {}
+
+    template <typename T>
+        requires std::is_arithmetic_v<T>
+    void write(T value) {
+        mBuffer.append(reinterpret_cast<char const*>(&value), sizeof(T));
+    }
+
+    void write(std::string_view bytes) {
+        write(static_cast<uint64_t>(bytes.size()));
+        mBuffer.append(bytes);
+    }
+
+    /**
+     * @brief 写入变长整数(LEB128)，小数值只占 1 字节
+     */
+    void writeVarint(uint64_t value) {
+        while (value >= 0x80) {
+            mBuffer.push_back(static_cast<char>(value | 0x80));
+            value >>= 7;
+        }
+        mBuffer.push_back(static_cast<char>(value));
+    }
+
+    /**
+     * @brief 写入有符号变长整数(ZigZag)，绝对值较小的负数同样紧凑
+     */
+    void writeZigzag(int64_t value) {
+        writeVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    /**
+     * @brief 按小端序写入 64 位定长整数，与本机字节序无关
+     */
+    void writeLittleEndian(uint64_t value) {
+        for (int i = 0; i < 8; ++i) {
+            mBuffer.push_back(static_cast<char>(value >> (i * 8)));
+        }
+    }
+
+    /**
+     * @brief 写入以变长整数为长度前缀的字节串
+     */
+    void writeVarBytes(std::string_view bytes) {
+        writeVarint(bytes.size());
+        mBuffer.append(bytes);
+    }
+
+    [[nodiscard]] size_t size() const { return mBuffer.size(); }
+};
+
+/**
+ * @brief 二进制读取器
+ * @note 越界读取不会抛出异常，而是标记失败；调用方在读取结束后统一检查 ok()
+ */
+class BinaryReader {
+    std::string_view mData;
+    size_t           mOffset{0};
+    bool             mFailed{false};
+
+public:
+    explicit BinaryReader(std::string_view data) : mData(data) {}
+
+    template <typename T>
+        requires std::is_arithmetic_v<T>
+    bool read(T& value) {
+        if (mFailed || remaining() < sizeof(T)) {
+            mFailed = true;
+            return false;
+        }
+        std::memcpy(&value, mData.data() + mOffset, sizeof(T));
+        mOffset += sizeof(T);
+        return true;
+    }
+
+    bool read(std::string_view& bytes) {
+        uint64_t length{0};
+        if (!read(length) || remaining() < length) {
+            mFailed = true;
+            return false;
+        }
+        bytes    = mData.substr(mOffset, static_cast<size_t>(length));
+        mOffset += static_cast<size_t>(length);
+        return true;
+    }
+
+    /**
+     * @brief 读取元素数量，数量超过剩余字节数时视为损坏
+     */
+    bool readCount(uint64_t& count) {
+        if (!read(count) || count > remaining()) {
+            mFailed = true;
+            return false;
+        }
+        return true;
+    }
+
+    bool readVarint(uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t byte{0};
+            if (!read(byte)) {
+                return false;
+            }
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        mFailed = true;
+        return false;
+    }
+
+    bool readZigzag(int64_t& value) {
+        uint64_t raw{0};
+        if (!readVarint(raw)) {
+            return false;
+        }
+        value = static_cast<int64_t>(raw >> 1) ^ -static_cast<int64_t>(raw & 1);
+        return true;
+    }
+
+    bool readLittleEndian(uint64_t& value) {
+        if (mFailed || remaining() < sizeof(uint64_t)) {
+            mFailed = true;
+            return false;
+        }
+        value = 0;
+        for (int i = 0; i < 8; ++i) {
+            value |= static_cast<uint64_t>(static_cast<uint8_t>(mData[mOffset + i])) << (i * 8);
+        }
+        mOffset += sizeof(uint64_t);
+        return true;
+    }
+
+    bool readVarBytes(std::string_view& bytes) {
+        uint64_t length{0};
+        if (!readVarint(length) || remaining() < length) {
+            mFailed = true;
+            return false;
+        }
+        bytes    = mData.substr(mOffset, static_cast<size_t>(length));
+        mOffset += static_cast<size_t>(length);
+        return true;
+    }
+
+    bool skip(size_t count) {
+        if (mFailed || remaining() < count) {
+            mFailed = true;
+            return false;
+        }
+        mOffset += count;
+        return true;
+    }
+
+    void fail() { mFailed = true; }
+
+    [[nodiscard]] bool ok() const { return !mFailed; }
+
+    [[nodiscard]] size_t remaining() const { return mData.size() - mOffset; }
+};
+
+
+} // namespace land::internal
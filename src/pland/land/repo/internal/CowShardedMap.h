@@ -0,0 +1,185 @@
+#pragma once
+#include "absl/container/flat_hash_map.h"
+#include "absl/hash/hash.h"
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace land::internal {
+
+
+/**
+ * @brief 分片写时复制哈希表
+ * 键按哈希高位分散到固定数量的分片，每个分片由 shared_ptr 持有。复制整表只复制分片指针，
+ * 修改时仅复制被修改的分片，且同一副本内每个分片至多复制一次；未修改的分片在新旧副本间共享。
+ * @note 用于不可变快照：副本一经发布(对其它线程可见)即不得再修改，修改必须在新复制的副本上进行
+ */
+template <typename Key, typename Value, size_t ShardBits = 6>
+class CowShardedMap {
+public:
+    inline static constexpr size_t ShardCount = size_t{1} << ShardBits;
+
+    using Shard      = absl::flat_hash_map<Key, Value>;
+    using value_type = typename Shard::value_type;
+
+    class const_iterator {
+        friend class CowShardedMap;
+
+        CowShardedMap const*           mMap{nullptr};
+        size_t                         mShard{ShardCount};
+        typename Shard::const_iterator mIter{};
+
+        const_iterator(CowShardedMap const* map, size_t shard) : mMap(map), mShard(shard) { _settle(); }
+
+        // 跳过空分片，停在下一个有效元素或末尾
+        void _settle() {
+            for (; mShard < ShardCount; ++mShard) {
+                auto const& shard = mMap->mShards[mShard];
+                if (shard && !shard->empty()) {
+                    mIter = shard->begin();
+                    return;
+                }
+            }
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = CowShardedMap::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = value_type const*;
+        using reference         = value_type const&;
+
+        const_iterator() = default;
+
+        reference operator*() const { return *mIter; }
+        pointer   operator->() const { return &*mIter; }
+
+        const_iterator& operator++() {
+            if (++mIter == mMap->mShards[mShard]->end()) {
+                ++mShard;
+                _settle();
+            }
+            return *this;
+        }
+        const_iterator operator++(int) {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        bool operator==(const_iterator const& other) const {
+            return mShard == other.mShard && (mShard == ShardCount || mIter == other.mIter);
+        }
+    };
+
+    CowShardedMap() = default;
+
+    // 复制得到的副本不独占任何分片，首次修改时再复制
+    CowShardedMap(CowShardedMap const& other) : mShards(other.mShards), mSize(other.mSize) {}
+    CowShardedMap& operator=(CowShardedMap const& other) {
+        mShards = other.mShards;
+        mOwned.reset();
+        mSize = other.mSize;
+        return *this;
+    }
+
+    CowShardedMap(CowShardedMap&& other) noexcept
+    : mShards(std::move(other.mShards)),
+      mOwned(std::exchange(other.mOwned, {})),
+      mSize(std::exchange(other.mSize, 0)) {}
+    CowShardedMap& operator=(CowShardedMap&& other) noexcept {
+        mShards = std::move(other.mShards);
+        mOwned  = std::exchange(other.mOwned, {});
+        mSize   = std::exchange(other.mSize, 0);
+        return *this;
+    }
+
+    [[nodiscard]] size_t size() const { return mSize; }
+    [[nodiscard]] bool   empty() const { return mSize == 0; }
+
+    [[nodiscard]] const_iterator begin() const { return const_iterator{this, 0}; }
+    [[nodiscard]] const_iterator end() const { return const_iterator{this, ShardCount}; }
+
+    /**
+     * @return 不存在时返回 nullptr
+     */
+    [[nodiscard]] Value const* find(Key const& key) const {
+        auto const& shard = mShards[shardOf(key)];
+        if (!shard) {
+            return nullptr;
+        }
+        auto iter = shard->find(key);
+        return iter == shard->end() ? nullptr : &iter->second;
+    }
+
+    [[nodiscard]] bool contains(Key const& key) const { return find(key) != nullptr; }
+
+    /**
+     * @brief 获取可修改的值
+     * @note 仅在键存在时复制所在分片
+     */
+    [[nodiscard]] Value* findMutable(Key const& key) {
+        auto const index = shardOf(key);
+        if (!mShards[index] || !mShards[index]->contains(key)) {
+            return nullptr;
+        }
+        return &_mutableShard(index).find(key)->second;
+    }
+
+    template <typename... Args>
+    std::pair<Value*, bool> try_emplace(Key const& key, Args&&... args) {
+        auto [iter, inserted] = _mutableShard(shardOf(key)).try_emplace(key, std::forward<Args>(args)...);
+        mSize                += inserted ? 1 : 0;
+        return {&iter->second, inserted};
+    }
+
+    Value& operator[](Key const& key) { return *try_emplace(key).first; }
+
+    bool erase(Key const& key) {
+        auto const index = shardOf(key);
+        if (!mShards[index] || !mShards[index]->contains(key)) {
+            return false;
+        }
+        _mutableShard(index).erase(key);
+        --mSize;
+        return true;
+    }
+
+    void reserve(size_t count) {
+        for (size_t i = 0; i < ShardCount; ++i) {
+            _mutableShard(i).reserve(count / ShardCount + 1);
+        }
+    }
+
+    /**
+     * @brief 当前副本独占的分片数量(即复制以来被修改过的分片)
+     */
+    [[nodiscard]] size_t ownedShardCount() const { return mOwned.count(); }
+
+    [[nodiscard]] static size_t shardOf(Key const& key) {
+        // 取哈希高位选择分片；分片内的哈希表使用低位定位，二者互不干扰
+        return static_cast<size_t>(static_cast<uint64_t>(absl::Hash<Key>{}(key)) >> (64 - ShardBits));
+    }
+
+private:
+    Shard& _mutableShard(size_t index) {
+        auto& shard = mShards[index];
+        if (!mOwned.test(index)) {
+            shard = shard ? std::make_shared<Shard>(*shard) : std::make_shared<Shard>();
+            mOwned.set(index);
+        }
+        return *shard;
+    }
+
+    std::array<std::shared_ptr<Shard>, ShardCount> mShards; // 分片(空指针表示空分片)
+    std::bitset<ShardCount>                        mOwned;  // 本副本独占、可原地修改的分片
+    size_t                                         mSize{0};
+};
+
+
+} // namespace land::internal
@@ -0,0 +1,457 @@
+#include "LandContextCodec.h"
+#include "BinaryStream.h"
+
+#include "pland/utils/JsonUtil.h"
+
+#include "mc/platform/UUID.h"
+
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace land::internal {
+
+namespace {
+
+// 字段编号，一经发布不可修改或复用
+enum Field : uint64_t {
+    Pos         = 1,  // 领地范围
+    TeleportPos = 2,  // 传送点
+    LandId      = 3,  // 领地ID
+    Dimension   = 4,  // 维度
+    PermTable   = 5,  // 权限表
+    Owner       = 6,  // 主人
+    Members     = 7,  // 成员
+    Name        = 8,  // 名称
+    BuyPrice    = 9,  // 原始购买价格
+    Flags       = 10, // 3D 领地 | 转换领地 | 主人为 XUID
+    ParentId    = 11, // 父领地ID
+    SubLandIds  = 12, // 子领地ID
+};
+
+enum Wire : uint64_t {
+    Varint = 0, // ZigZag 变长整数
+    Bytes  = 2, // 长度前缀字节串
+};
+
+enum UuidKind : uint8_t {
+    Binary = 0, // 16 字节(两个小端序 64 位整数)
+    Text   = 1, // 无法无损转换的原始字符串(XUID 等)
+};
+
+constexpr uint64_t Flag3D        = 1 << 0;
+constexpr uint64_t FlagConverted = 1 << 1;
+constexpr uint64_t FlagXuidOwner = 1 << 2;
+
+// 权限表按字节逐位打包，要求所有权限字段均为 bool
+static_assert(std::is_trivially_copyable_v<EnvironmentPerms> && alignof(EnvironmentPerms) == 1);
+static_assert(std::is_trivially_copyable_v<RolePerms> && alignof(RolePerms) == 1);
+static_assert(sizeof(RolePerms::Entry) == 2 * sizeof(bool));
+
+using EnvironmentBits = std::array<unsigned char, sizeof(EnvironmentPerms)>;
+using RoleBits        = std::array<unsigned char, sizeof(RolePerms)>;
+
+void writeVarintField(BinaryWriter& writer, Field field, int64_t value) {
+    writer.writeVarint(field << 3 | Varint);
+    writer.writeZigzag(value);
+}
+
+void writeStringField(BinaryWriter& writer, Field field, std::string_view value) {
+    writer.writeVarint(field << 3 | Bytes);
+    writer.writeVarBytes(value);
+}
+
+template <typename Fn>
+void writeBytesField(BinaryWriter& writer, Field field, Fn&& fill) {
+    std::string  body;
+    BinaryWriter bodyWriter{body};
+    fill(bodyWriter);
+    writeStringField(writer, field, body);
+}
+
+void writePos(BinaryWriter& writer, LandPos const& pos) {
+    writer.writeZigzag(pos.x);
+    writer.writeZigzag(pos.y);
+    writer.writeZigzag(pos.z);
+}
+
+bool readPos(BinaryReader& reader, LandPos& pos) {
+    int64_t x{0}, y{0}, z{0};
+    if (!reader.readZigzag(x) || !reader.readZigzag(y) || !reader.readZigzag(z)) {
+        return false;
+    }
+    pos.x = static_cast<int>(x);
+    pos.y = static_cast<int>(y);
+    pos.z = static_cast<int>(z);
+    return true;
+}
+
+// 元素数量超过剩余字节数时视为损坏
+bool readCount(BinaryReader& reader, uint64_t& count) {
+    if (!reader.readVarint(count) || count > reader.remaining()) {
+        reader.fail();
+        return false;
+    }
+    return true;
+}
+
+void writeUuid(BinaryWriter& writer, std::string const& text) {
+    if (mce::UUID::canParse(text)) {
+        auto uuid = mce::UUID::fromString(text);
+        if (uuid.asString() == text) {
+            writer.write(static_cast<uint8_t>(UuidKind::Binary));
+            writer.writeLittleEndian(uuid.a);
+            writer.writeLittleEndian(uuid.b);
+            return;
+        }
+    }
+    writer.write(static_cast<uint8_t>(UuidKind::Text));
+    writer.writeVarBytes(text);
+}
+
+bool readUuid(BinaryReader& reader, std::string& text) {
+    uint8_t kind{0};
+    if (!reader.read(kind)) {
+        return false;
+    }
+    if (kind == UuidKind::Binary) {
+        mce::UUID uuid;
+        // 格式版本 1 按本机字节序写入，而插件仅运行于小端平台，两个版本的字节布局一致
+        if (!reader.readLittleEndian(uuid.a) || !reader.readLittleEndian(uuid.b)) {
+            return false;
+        }
+        text = uuid.asString();
+        return true;
+    }
+    std::string_view raw;
+    if (kind != UuidKind::Text || !reader.readVarBytes(raw)) {
+        return false;
+    }
+    text = raw;
+    return true;
+}
+
+void writePerms(BinaryWriter& writer, LandPermTable const& table) {
+    EnvironmentBits environment;
+    RoleBits        role;
+    std::memcpy(environment.data(), &table.environment, environment.size());
+    std::memcpy(role.data(), &table.role, role.size());
+
+    std::string bits((environment.size() + role.size() + 7) / 8, '\0');
+    size_t      index = 0;
+    for (auto value : environment) {
+        bits[index / 8] |= static_cast<char>((value ? 1 : 0) << (index % 8));
+        ++index;
+    }
+    for (auto value : role) {
+        bits[index / 8] |= static_cast<char>((value ? 1 : 0) << (index % 8));
+        ++index;
+    }
+    writer.writeVarint(environment.size());
+    writer.writeVarint(role.size());
+    writer.writeVarBytes(bits);
+}
+
+/**
+ * @brief 解包权限位图
+ * @return 位数与期望不一致时返回 false
+ */
+bool readPermBits(std::string_view data, size_t environmentBits, size_t roleBits, std::vector<bool>& out) {
+    BinaryReader     reader{data};
+    uint64_t         environmentCount{0};
+    uint64_t         roleCount{0};
+    std::string_view bits;
+    reader.readVarint(environmentCount);
+    reader.readVarint(roleCount);
+    reader.readVarBytes(bits);
+    if (!reader.ok() || environmentCount != environmentBits || roleCount != roleBits
+        || bits.size() != (environmentBits + roleBits + 7) / 8) {
+        return false;
+    }
+    out.resize(environmentBits + roleBits);
+    for (size_t i = 0; i < out.size(); ++i) {
+        out[i] = (static_cast<uint8_t>(bits[i / 8]) >> (i % 8)) & 1;
+    }
+    return true;
+}
+
+bool readHeader(BinaryReader& reader, int& schema) {
+    uint8_t magic{0};
+    uint8_t version{0};
+    int64_t value{0};
+    reader.read(magic);
+    reader.read(version);
+    reader.readZigzag(value);
+    if (!reader.ok() || magic != LandContextCodec::Magic || version < 1 || version > LandContextCodec::FormatVersion) {
+        return false;
+    }
+    schema = static_cast<int>(value);
+    return true;
+}
+
+/**
+ * @brief 解码除权限表以外的字段
+ * @param perms 权限表字段的原始数据(位序取决于结构版本)
+ */
+bool readFields(BinaryReader& reader, LandContext& context, std::string_view& perms) {
+    while (reader.remaining() > 0) {
+        uint64_t key{0};
+        if (!reader.readVarint(key)) {
+            return false;
+        }
+        auto const field = key >> 3;
+        auto const wire  = key & 0x7;
+
+        if (wire == Varint) {
+            int64_t value{0};
+            if (!reader.readZigzag(value)) {
+                return false;
+            }
+            switch (field) {
+            case LandId:
+                context.mLandID = value;
+                break;
+            case Dimension:
+                context.mLandDimid = static_cast<LandDimid>(value);
+                break;
+            case BuyPrice:
+                context.mOriginalBuyPrice = static_cast<int>(value);
+                break;
+            case Flags:
+                context.mIs3DLand        = (value & Flag3D) != 0;
+                context.mIsConvertedLand = (value & FlagConverted) != 0;
+                context.mOwnerDataIsXUID = (value & FlagXuidOwner) != 0;
+                break;
+            case ParentId:
+                context.mParentLandID = value;
+                break;
+            default:
+                break; // 未知字段
+            }
+            continue;
+        }
+        if (wire != Bytes) {
+            return false;
+        }
+
+        std::string_view bytes;
+        if (!reader.readVarBytes(bytes)) {
+            return false;
+        }
+        BinaryReader body{bytes};
+        uint64_t     count{0};
+        switch (field) {
+        case Pos:
+            readPos(body, context.mPos.min);
+            readPos(body, context.mPos.max);
+            break;
+        case TeleportPos:
+            readPos(body, context.mTeleportPos);
+            break;
+        case PermTable:
+            perms = bytes;
+            break;
+        case Owner:
+            readUuid(body, context.mLandOwner);
+            break;
+        case Members:
+            if (readCount(body, count)) {
+                context.mLandMembers.resize(static_cast<size_t>(count));
+                for (auto& member : context.mLandMembers) {
+                    readUuid(body, member);
+                }
+            }
+            break;
+        case Name:
+            context.mLandName = bytes;
+            break;
+        case SubLandIds:
+            if (readCount(body, count)) {
+                context.mSubLandIDs.resize(static_cast<size_t>(count));
+                for (auto& id : context.mSubLandIDs) {
+                    int64_t value{0};
+                    body.readZigzag(value);
+                    id = value;
+                }
+            }
+            break;
+        default:
+            break; // 未知字段
+        }
+        if (!body.ok()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool LandContextCodec::isBinary(std::string_view data) {
+    return !data.empty() && static_cast<uint8_t>(data.front()) == Magic;
+}
+
+std::optional<int> LandContextCodec::peekSchema(std::string_view data) {
+    BinaryReader reader{data};
+    int          schema{0};
+    if (!readHeader(reader, schema)) {
+        return std::nullopt;
+    }
+    return schema;
+}
+
+std::string LandContextCodec::encode(LandContext const& context, uint8_t groups) {
+    std::string  buffer;
+    BinaryWriter writer{buffer};
+    writer.write(Magic);
+    writer.write(FormatVersion);
+    writer.writeZigzag(LandSchemaVersion);
+
+    if (groups & Range) {
+        writeBytesField(writer, Pos, [&](BinaryWriter& body) {
+            writePos(body, context.mPos.min);
+            writePos(body, context.mPos.max);
+        });
+    }
+    if (groups & Teleport) {
+        writeBytesField(writer, TeleportPos, [&](BinaryWriter& body) { writePos(body, context.mTeleportPos); });
+    }
+    if (groups & Identity) {
+        writeVarintField(writer, LandId, context.mLandID);
+        writeVarintField(writer, Dimension, context.mLandDimid);
+        writeBytesField(writer, Owner, [&](BinaryWriter& body) { writeUuid(body, context.mLandOwner); });
+        writeVarintField(
+            writer,
+            Flags,
+            (context.mIs3DLand ? Flag3D : 0) | (context.mIsConvertedLand ? FlagConverted : 0)
+                | (context.mOwnerDataIsXUID ? FlagXuidOwner : 0)
+        );
+    }
+    if (groups & Perms) {
+        writeBytesField(writer, PermTable, [&](BinaryWriter& body) { writePerms(body, context.mLandPermTable); });
+    }
+    if (groups & Price) {
+        writeVarintField(writer, BuyPrice, context.mOriginalBuyPrice);
+    }
+    if (groups & Hierarchy) {
+        writeVarintField(writer, ParentId, context.mParentLandID);
+        writeBytesField(writer, SubLandIds, [&](BinaryWriter& body) {
+            body.writeVarint(context.mSubLandIDs.size());
+            for (auto id : context.mSubLandIDs) {
+                body.writeZigzag(id);
+            }
+        });
+    }
+    if (groups & Members) {
+        writeBytesField(writer, Field::Members, [&](BinaryWriter& body) {
+            body.writeVarint(context.mLandMembers.size());
+            for (auto const& member : context.mLandMembers) {
+                writeUuid(body, member);
+            }
+        });
+    }
+    if (groups & Name) {
+        writeStringField(writer, Field::Name, context.mLandName);
+    }
+    return buffer;
+}
+
+bool LandContextCodec::decode(std::string_view data, LandContext& context) {
+    BinaryReader reader{data};
+    int          schema{0};
+    if (!readHeader(reader, schema) || schema != LandSchemaVersion) {
+        return false;
+    }
+
+    std::string_view perms;
+    if (!readFields(reader, context, perms)) {
+        return false;
+    }
+    if (perms.empty()) {
+        return true; // 保留默认权限
+    }
+
+    std::vector<bool> bits;
+    if (!readPermBits(perms, sizeof(EnvironmentPerms), sizeof(RolePerms), bits)) {
+        return false;
+    }
+    EnvironmentBits environment;
+    RoleBits        role;
+    for (size_t i = 0; i < environment.size(); ++i) {
+        environment[i] = bits[i];
+    }
+    for (size_t i = 0; i < role.size(); ++i) {
+        role[i] = bits[environment.size() + i];
+    }
+    std::memcpy(&context.mLandPermTable.environment, environment.data(), environment.size());
+    std::memcpy(&context.mLandPermTable.role, role.data(), role.size());
+    context.version = LandSchemaVersion;
+    return true;
+}
+
+std::optional<nlohmann::json> LandContextCodec::decodeToJson(std::string_view data, PermLayout const& layout) {
+    BinaryReader reader{data};
+    int          schema{0};
+    if (!readHeader(reader, schema)) {
+        return std::nullopt;
+    }
+
+    LandContext      context;
+    std::string_view perms;
+    if (!readFields(reader, context, perms)) {
+        return std::nullopt;
+    }
+
+    nlohmann::json json = json_util::struct2json(context);
+    json["version"]     = schema;
+    if (perms.empty()) {
+        json.erase("mLandPermTable"); // 交由迁移与默认值补全
+        return json;
+    }
+
+    std::vector<bool> bits;
+    if (!readPermBits(perms, layout.environment.size(), layout.role.size() * 2, bits)) {
+        return std::nullopt;
+    }
+    auto environment = nlohmann::json::object();
+    auto role        = nlohmann::json::object();
+    for (size_t i = 0; i < layout.environment.size(); ++i) {
+        environment[layout.environment[i]] = static_cast<bool>(bits[i]);
+    }
+    for (size_t i = 0; i < layout.role.size(); ++i) {
+        auto const base      = layout.environment.size() + i * 2;
+        role[layout.role[i]] = {
+            {"member", static_cast<bool>(bits[base])    },
+            {"guest",  static_cast<bool>(bits[base + 1])}
+        };
+    }
+    json["mLandPermTable"] = {
+        {"environment", std::move(environment)},
+        {"role",        std::move(role)       }
+    };
+    return json;
+}
+
+LandContextCodec::PermLayout const& LandContextCodec::currentPermLayout() {
+    static PermLayout const layout = [] {
+        LandPermTable table{};
+        auto          json = json_util::struct2json(table);
+
+        PermLayout result;
+        for (auto const& [key, value] : json["environment"].items()) {
+            result.environment.push_back(key);
+        }
+        for (auto const& [key, value] : json["role"].items()) {
+            result.role.push_back(key);
+        }
+        if (result.environment.size() != sizeof(EnvironmentPerms) || result.role.size() * 2 != sizeof(RolePerms)) {
+            throw std::logic_error("LandPermTable fields must all be bool");
+        }
+        return result;
+    }();
+    return layout;
+}
+
+
+} // namespace land::internal
@@ -0,0 +1,88 @@
+#pragma once
+#include "pland/Global.h"
+#include "pland/land/repo/LandContext.h"
+
+#include "nlohmann/json.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace land::internal {
+
+
+/**
+ * @brief LandContext 紧凑二进制编码
+ * 格式: 魔数 | 格式版本 | 结构版本(LandSchemaVersion) | 字段...
+ * 每个字段以 (编号 << 3 | 类型) 开头，类型为变长整数或字节串；解码时跳过未知编号，缺失的字段保留默认值。
+ * 权限表按字段声明顺序打包为位图，坐标与 ID 使用 ZigZag 变长整数，UUID 以 16 字节小端序存储。
+ * @note 字段编号一经发布不可修改或复用
+ */
+class LandContextCodec final {
+public:
+    inline static constexpr uint8_t Magic         = 0xB1; // 首字节(JSON 不会以该字节开头)
+    inline static constexpr uint8_t FormatVersion = 2;    // 编码格式版本(2: UUID 固定为小端序，仍可读取 1)
+
+    /**
+     * @brief 权限表位序(按字段声明顺序排列的权限名)
+     * 写入二进制数据时的位序随结构版本保存，用于将旧版本数据还原为 JSON 交由 LandMigrator 升级
+     */
+    struct PermLayout {
+        std::vector<std::string> environment; // 环境权限
+        std::vector<std::string> role;        // 角色权限(每项占 member、guest 两位)
+    };
+
+    /**
+     * @brief 字段分组
+     * 变更日志按分组记录单个字段的修改，解码时合并到已有数据
+     */
+    enum Group : uint8_t {
+        Range     = 1 << 0, // 领地范围
+        Teleport  = 1 << 1, // 传送点
+        Perms     = 1 << 2, // 权限表
+        Price     = 1 << 3, // 原始购买价格
+        Hierarchy = 1 << 4, // 父领地ID、子领地ID
+        Identity  = 1 << 5, // 领地ID、维度、主人、标记
+        Members   = 1 << 6, // 成员
+        Name      = 1 << 7, // 名称
+        Cold      = Members, // 领地对象按需展开的字段
+        All       = Range | Teleport | Perms | Price | Hierarchy | Identity | Members | Name,
+    };
+
+    LandContextCodec() = delete;
+
+    [[nodiscard]] static bool isBinary(std::string_view data);
+
+    /**
+     * @brief 读取数据的结构版本
+     */
+    [[nodiscard]] static std::optional<int> peekSchema(std::string_view data);
+
+    /**
+     * @param groups 写入的字段分组
+     */
+    [[nodiscard]] static std::string encode(LandContext const& context, uint8_t groups = All);
+
+    /**
+     * @brief 解码当前结构版本的数据
+     * 仅写入数据中存在的字段，可用于将部分字段的编码合并到已有的 LandContext
+     * @return 数据损坏或结构版本不一致时返回 false
+     */
+    [[nodiscard]] static bool decode(std::string_view data, LandContext& context);
+
+    /**
+     * @brief 将旧结构版本的数据还原为该版本的 JSON
+     * @param layout 写入数据时的权限表位序
+     */
+    [[nodiscard]] static std::optional<nlohmann::json> decodeToJson(std::string_view data, PermLayout const& layout);
+
+    /**
+     * @brief 当前结构版本的权限表位序
+     */
+    [[nodiscard]] static PermLayout const& currentPermLayout();
+};
+
+
+} // namespace land::internal
@@ -0,0 +1,324 @@
+#include "LandContextJsonReader.h"
+#include "LandContextCodec.h"
+
+#include "nlohmann/json.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace land::internal {
+
+namespace {
+
+/**
+ * @brief 权限名 --> 字段下标
+ */
+struct PermIndex {
+    std::unordered_map<std::string_view, size_t> mEnvironment;
+    std::unordered_map<std::string_view, size_t> mRole;
+
+    static PermIndex const& get() {
+        static PermIndex const index = [] {
+            auto const& layout = LandContextCodec::currentPermLayout(); // 名称存储于静态对象中
+            PermIndex   result;
+            for (size_t i = 0; i < layout.environment.size(); ++i) {
+                result.mEnvironment.emplace(layout.environment[i], i);
+            }
+            for (size_t i = 0; i < layout.role.size(); ++i) {
+                result.mRole.emplace(layout.role[i], i);
+            }
+            return result;
+        }();
+        return index;
+    }
+};
+
+bool isRootField(std::string_view key) {
+    static constexpr std::string_view fields[] = {
+        "version",
+        "mPos",
+        "mTeleportPos",
+        "mLandID",
+        "mLandDimid",
+        "mIs3DLand",
+        "mLandPermTable",
+        "mLandOwner",
+        "mLandMembers",
+        "mLandName",
+        "mOriginalBuyPrice",
+        "mIsConvertedLand",
+        "mOwnerDataIsXUID",
+        "mParentLandID",
+        "mSubLandIDs",
+    };
+    return std::find(std::begin(fields), std::end(fields), key) != std::end(fields);
+}
+
+class Handler final : public nlohmann::json_sax<nlohmann::json> {
+    enum class Scope : uint8_t {
+        Root,        // 顶层对象
+        Aabb,        // mPos
+        Pos,         // 坐标
+        PermTable,   // mLandPermTable
+        Environment, // 环境权限
+        Role,        // 角色权限
+        RoleEntry,   // 单项角色权限
+        Members,     // 成员数组
+        SubLands,    // 子领地数组
+        Skip,        // 未知字段
+    };
+
+    LandContext&                                        mContext;
+    std::vector<Scope>                                  mScopes;
+    std::string                                         mKey;                // 当前键
+    LandPos*                                            mPos{nullptr};       // 当前坐标
+    size_t                                              mRoleIndex{0};       // 当前角色权限下标
+    bool                                                mHasVersion{false};  // 是否读取到版本号
+    bool                                                mHasName{false};     // 是否读取到名称
+    std::array<unsigned char, sizeof(EnvironmentPerms)> mEnvironment;        // 环境权限(按字段顺序)
+    std::array<unsigned char, sizeof(RolePerms)>        mRole;               // 角色权限(每项 member、guest 两位)
+
+public:
+    explicit Handler(LandContext& context) : mContext(context) {
+        std::memcpy(mEnvironment.data(), &context.mLandPermTable.environment, mEnvironment.size());
+        std::memcpy(mRole.data(), &context.mLandPermTable.role, mRole.size());
+        mScopes.reserve(8);
+    }
+
+    bool finish() {
+        if (!mHasVersion || !mHasName) {
+            return false;
+        }
+        std::memcpy(&mContext.mLandPermTable.environment, mEnvironment.data(), mEnvironment.size());
+        std::memcpy(&mContext.mLandPermTable.role, mRole.data(), mRole.size());
+        return true;
+    }
+
+    bool null() override { return _other(); }
+
+    bool boolean(bool value) override {
+        switch (_top()) {
+        case Scope::Root:
+            if (mKey == "mIs3DLand") {
+                mContext.mIs3DLand = value;
+            } else if (mKey == "mIsConvertedLand") {
+                mContext.mIsConvertedLand = value;
+            } else if (mKey == "mOwnerDataIsXUID") {
+                mContext.mOwnerDataIsXUID = value;
+            } else {
+                return !isRootField(mKey);
+            }
+            return true;
+        case Scope::Environment: {
+            auto const& index = PermIndex::get().mEnvironment;
+            if (auto iter = index.find(mKey); iter != index.end()) {
+                mEnvironment[iter->second] = value;
+            }
+            return true;
+        }
+        case Scope::RoleEntry:
+            if (mKey == "member") {
+                mRole[mRoleIndex * 2] = value;
+            } else if (mKey == "guest") {
+                mRole[mRoleIndex * 2 + 1] = value;
+            }
+            return true;
+        default:
+            return _other();
+        }
+    }
+
+    bool number_integer(number_integer_t value) override { return _integer(value); }
+
+    bool number_unsigned(number_unsigned_t value) override {
+        if (value > static_cast<number_unsigned_t>(std::numeric_limits<int64_t>::max())) {
+            return _other();
+        }
+        return _integer(static_cast<int64_t>(value));
+    }
+
+    bool number_float(number_float_t, string_t const&) override { return _other(); }
+
+    bool string(string_t& value) override {
+        switch (_top()) {
+        case Scope::Root:
+            if (mKey == "mLandOwner") {
+                mContext.mLandOwner = std::move(value);
+            } else if (mKey == "mLandName") {
+                mContext.mLandName = std::move(value);
+                mHasName           = true;
+            } else {
+                return !isRootField(mKey);
+            }
+            return true;
+        case Scope::Members:
+            mContext.mLandMembers.push_back(std::move(value));
+            return true;
+        default:
+            return _other();
+        }
+    }
+
+    bool binary(binary_t&) override { return false; }
+
+    bool start_object(std::size_t) override {
+        if (mScopes.empty()) {
+            mScopes.push_back(Scope::Root);
+            return true;
+        }
+
+        auto next = Scope::Skip;
+        switch (_top()) {
+        case Scope::Root:
+            if (mKey == "mPos") {
+                next = Scope::Aabb;
+            } else if (mKey == "mTeleportPos") {
+                next = Scope::Pos;
+                mPos = &mContext.mTeleportPos;
+            } else if (mKey == "mLandPermTable") {
+                next = Scope::PermTable;
+            } else if (isRootField(mKey)) {
+                return false;
+            }
+            break;
+        case Scope::Aabb:
+            if (mKey == "min" || mKey == "max") {
+                next = Scope::Pos;
+                mPos = mKey == "min" ? &mContext.mPos.min : &mContext.mPos.max;
+            }
+            break;
+        case Scope::PermTable:
+            if (mKey == "environment") {
+                next = Scope::Environment;
+            } else if (mKey == "role") {
+                next = Scope::Role;
+            }
+            break;
+        case Scope::Role: {
+            auto const& index = PermIndex::get().mRole;
+            if (auto iter = index.find(mKey); iter != index.end()) {
+                next       = Scope::RoleEntry;
+                mRoleIndex = iter->second;
+            }
+            break;
+        }
+        case Scope::Skip:
+            break;
+        default:
+            return false; // 类型不匹配
+        }
+        mScopes.push_back(next);
+        return true;
+    }
+
+    bool key(string_t& value) override {
+        mKey = value;
+        return true;
+    }
+
+    bool end_object() override {
+        mScopes.pop_back();
+        return true;
+    }
+
+    bool start_array(std::size_t) override {
+        if (mScopes.empty()) {
+            return false;
+        }
+
+        auto next = Scope::Skip;
+        switch (_top()) {
+        case Scope::Root:
+            if (mKey == "mLandMembers") {
+                next = Scope::Members;
+                mContext.mLandMembers.clear();
+            } else if (mKey == "mSubLandIDs") {
+                next = Scope::SubLands;
+                mContext.mSubLandIDs.clear();
+            } else if (isRootField(mKey)) {
+                return false;
+            }
+            break;
+        case Scope::Skip:
+        case Scope::Aabb:
+        case Scope::PermTable:
+        case Scope::Role:
+            break;
+        default:
+            return false; // 类型不匹配
+        }
+        mScopes.push_back(next);
+        return true;
+    }
+
+    bool end_array() override {
+        mScopes.pop_back();
+        return true;
+    }
+
+    bool parse_error(std::size_t, std::string const&, nlohmann::detail::exception const&) override { return false; }
+
+private:
+    [[nodiscard]] Scope _top() const { return mScopes.empty() ? Scope::Skip : mScopes.back(); }
+
+    // 非预期的值: 位于未知字段中时忽略，否则视为类型不匹配
+    [[nodiscard]] bool _other() const {
+        auto scope = _top();
+        return scope == Scope::Skip || (scope == Scope::Root && !isRootField(mKey));
+    }
+
+    bool _integer(int64_t value) {
+        switch (_top()) {
+        case Scope::Root:
+            if (mKey == "version") {
+                mHasVersion = true;
+                return value == LandSchemaVersion; // 旧版本数据交由 LandMigrator 处理
+            } else if (mKey == "mLandID") {
+                mContext.mLandID = value;
+            } else if (mKey == "mLandDimid") {
+                mContext.mLandDimid = static_cast<LandDimid>(value);
+            } else if (mKey == "mOriginalBuyPrice") {
+                mContext.mOriginalBuyPrice = static_cast<int>(value);
+            } else if (mKey == "mParentLandID") {
+                mContext.mParentLandID = value;
+            } else {
+                return !isRootField(mKey);
+            }
+            return true;
+        case Scope::Pos:
+            if (mKey == "x") {
+                mPos->x = static_cast<int>(value);
+            } else if (mKey == "y") {
+                mPos->y = static_cast<int>(value);
+            } else if (mKey == "z") {
+                mPos->z = static_cast<int>(value);
+            }
+            return true;
+        case Scope::SubLands:
+            mContext.mSubLandIDs.push_back(value);
+            return true;
+        default:
+            return _other();
+        }
+    }
+};
+
+} // namespace
+
+bool LandContextJsonReader::read(std::string_view json, LandContext& context) {
+    Handler handler{context};
+    if (!nlohmann::json::sax_parse(json.begin(), json.end(), &handler)) {
+        return false;
+    }
+    return handler.finish();
+}
+
+
+} // namespace land::internal
@@ -0,0 +1,28 @@
+#pragma once
+#include "pland/land/repo/LandContext.h"
+
+#include <string_view>
+
+namespace land::internal {
+
+
+/**
+ * @brief 领地数据流式(SAX)解析
+ * 直接将 JSON 文本写入 LandContext，不构建 DOM，也不经过反射；未知字段会被跳过。
+ * 仅处理当前结构版本的数据，旧版本数据需经 LandMigrator 升级。
+ */
+class LandContextJsonReader final {
+public:
+    LandContextJsonReader() = delete;
+
+    /**
+     * @brief 解析领地数据
+     * @param context 解析目标，缺失的字段保留原值；返回 false 时可能已被部分写入
+     * @return 结构版本不是当前版本、缺少版本号或名称、字段类型不匹配或 JSON 损坏时返回 false，
+     *         调用方应退回 DOM + LandMigrator 路径
+     */
+    [[nodiscard]] static bool read(std::string_view json, LandContext& context);
+};
+
+
+} // namespace land::internal
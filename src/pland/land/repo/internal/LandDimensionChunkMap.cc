@@ -1,92 +1,925 @@
 #include "LandDimensionChunkMap.h"
-#include "BidirectionalMap.h"
+#include "BinaryStream.h"
 #include "ChunkEncoder.h"
+#include "MortonEncoder.h"
 
 #include "pland/land/Land.h"
 
+#include <algorithm>
+
 namespace land ::internal {
 
-LandDimensionChunkMap::LandDimensionChunkMap() = default;
+namespace {
+
+using ChunkEntry     = LandDimensionChunkMap::ChunkEntry;
+using ChunkBucket    = LandDimensionChunkMap::ChunkBucket;
+using LargeLandEntry = LandDimensionChunkMap::LargeLandEntry;
+using ChunkRect      = LandDimensionChunkMap::ChunkRect;
+using LandRecord     = LandDimensionChunkMap::LandRecord;
+using SectionKey     = LandDimensionChunkMap::SectionKey;
+using DimensionIndex = LandDimensionChunkMap::DimensionIndex;
+using Region         = LandDimensionChunkMap::Region;
+using LargeLandList  = LandDimensionChunkMap::LargeLandList;
+
+void insertSorted(ChunkBucket& bucket, ChunkEntry entry) {
+    // 层级降序，同层级按插入顺序
+    auto pos = std::upper_bound(bucket.begin(), bucket.end(), entry, [](ChunkEntry const& a, ChunkEntry const& b) {
+        return a.mLevel > b.mLevel;
+    });
+    bucket.insert(pos, entry);
+}
+
+uint16_t makeColumnMask(int chunkCoord, int min, int max) {
+    int const base = chunkCoord * 16;
+    int const lo   = std::max(min, base) - base;      // [0, 15]
+    int const hi   = std::min(max, base + 15) - base; // [0, 15]
+    if (lo > hi) {
+        return 0;
+    }
+    return static_cast<uint16_t>(((1u << (hi + 1)) - 1) & ~((1u << lo) - 1));
+}
+
+template <typename Map, typename Key>
+void eraseEntry(Map& buckets, Key const& key, LandID landId) {
+    auto iter = buckets.find(key);
+    if (iter == buckets.end()) {
+        return;
+    }
+    auto& bucket = iter->second;
+    bucket.erase(
+        std::remove_if(bucket.begin(), bucket.end(), [landId](ChunkEntry const& e) { return e.mLandId == landId; }),
+        bucket.end()
+    );
+    if (bucket.empty()) {
+        buckets.erase(iter);
+    }
+}
+
+template <typename Map, typename Key>
+void resortEntry(Map& buckets, Key const& key, LandID landId, int level) {
+    auto iter = buckets.find(key);
+    if (iter == buckets.end()) {
+        return;
+    }
+    auto& bucket = iter->second;
+    auto  entry  = std::find_if(bucket.begin(), bucket.end(), [landId](ChunkEntry const& e) {
+        return e.mLandId == landId;
+    });
+    if (entry == bucket.end() || entry->mLevel == level) {
+        return;
+    }
+    auto copy   = *entry;
+    copy.mLevel = static_cast<int16_t>(level);
+    bucket.erase(entry);
+    insertSorted(bucket, copy);
+}
+
+template <typename Map, typename Key>
+void updateEntry(Map& buckets, Key const& key, ChunkEntry const& src) {
+    auto iter = buckets.find(key);
+    if (iter == buckets.end()) {
+        return;
+    }
+    for (auto& e : iter->second) {
+        if (e.mLandId == src.mLandId) {
+            // 层级不变，桶内顺序无需调整
+            e.mMaskX  = src.mMaskX;
+            e.mMaskZ  = src.mMaskZ;
+            e.mFirstX = src.mFirstX;
+            e.mFirstZ = src.mFirstZ;
+            return;
+        }
+    }
+}
+
+ChunkEntry makeEntry(Land const& land, LandDimensionChunkMap::ChunkRect const& rect, int x, int z) {
+    auto const& aabb = land.getAABB();
+    return ChunkEntry{
+        land.getId(),
+        static_cast<int16_t>(land.getNestedLevel()),
+        makeColumnMask(x, aabb.min.x, aabb.max.x),
+        makeColumnMask(z, aabb.min.z, aabb.max.z),
+        land.is3D(),
+        x == rect.mMinX,
+        z == rect.mMinZ,
+        true
+    };
+}
 
-bool LandDimensionChunkMap::hasDimension(LandDimid dimid) const { return mMap.contains(dimid); }
+template <typename Map>
+void mergeBuckets(Map& dst, Map&& src) {
+    if (dst.empty()) {
+        dst = std::move(src);
+        return;
+    }
+    for (auto& [key, bucket] : src) {
+        auto [iter, inserted] = dst.try_emplace(key);
+        if (inserted) {
+            iter->second = std::move(bucket);
+            continue;
+        }
+        for (auto const& e : bucket) {
+            insertSorted(iter->second, e);
+        }
+    }
+}
+
+/**
+ * @brief 按分区遍历区块矩形
+ * @param fn void(ChunkRect const&)，参数为矩形与单个分区的交集
+ */
+template <typename Fn>
+void forEachRegionIn(ChunkRect const& rect, Fn&& fn) {
+    constexpr int shift = Region::Shift;
+    constexpr int mask  = (1 << shift) - 1;
+    for (int rx = rect.mMinX >> shift; rx <= rect.mMaxX >> shift; ++rx) {
+        for (int rz = rect.mMinZ >> shift; rz <= rect.mMaxZ >> shift; ++rz) {
+            fn(ChunkRect{
+                std::max(rect.mMinX, rx << shift),
+                std::min(rect.mMaxX, (rx << shift) + mask),
+                std::max(rect.mMinZ, rz << shift),
+                std::min(rect.mMaxZ, (rz << shift) + mask)
+            });
+        }
+    }
+}
+
+/**
+ * @brief 遍历矩形差集 a \ b 中的区块
+ * 差集至多分解为 4 个矩形: b 左侧、b 右侧，以及 X 方向重叠部分中 b 的上方与下方
+ */
+template <typename Fn>
+void forEachInDifference(
+    LandDimensionChunkMap::ChunkRect const& a,
+    LandDimensionChunkMap::ChunkRect const& b,
+    Fn&&                                    fn
+) {
+    auto visit = [&](int minX, int maxX, int minZ, int maxZ) {
+        for (int x = minX; x <= maxX; ++x) {
+            for (int z = minZ; z <= maxZ; ++z) {
+                fn(x, z);
+            }
+        }
+    };
+    visit(a.mMinX, std::min(a.mMaxX, b.mMinX - 1), a.mMinZ, a.mMaxZ);
+    visit(std::max(a.mMinX, b.mMaxX + 1), a.mMaxX, a.mMinZ, a.mMaxZ);
+
+    int const midMinX = std::max(a.mMinX, b.mMinX);
+    int const midMaxX = std::min(a.mMaxX, b.mMaxX);
+    visit(midMinX, midMaxX, a.mMinZ, std::min(a.mMaxZ, b.mMinZ - 1));
+    visit(midMinX, midMaxX, std::max(a.mMinZ, b.mMaxZ + 1), a.mMaxZ);
+}
+
+// 序列化
+void writeEntry(BinaryWriter& writer, ChunkEntry const& e) {
+    writer.write(e.mLandId);
+    writer.write(static_cast<int>(e.mLevel)); // 文件格式保持 int32
+    writer.write(e.mMaskX);
+    writer.write(e.mMaskZ);
+    writer.write(static_cast<uint8_t>(e.mIs3D | e.mFirstX << 1 | e.mFirstZ << 2 | e.mFirstSection << 3));
+}
+
+bool readEntry(BinaryReader& reader, ChunkEntry& e) {
+    uint8_t flags{0};
+    int     level{0};
+    reader.read(e.mLandId);
+    reader.read(level);
+    reader.read(e.mMaskX);
+    reader.read(e.mMaskZ);
+    reader.read(flags);
+    e.mLevel        = static_cast<int16_t>(level);
+    e.mIs3D         = flags & 1;
+    e.mFirstX       = flags >> 1 & 1;
+    e.mFirstZ       = flags >> 2 & 1;
+    e.mFirstSection = flags >> 3 & 1;
+    return reader.ok();
+}
+
+void writeRect(BinaryWriter& writer, ChunkRect const& rect) {
+    writer.write(rect.mMinX);
+    writer.write(rect.mMaxX);
+    writer.write(rect.mMinZ);
+    writer.write(rect.mMaxZ);
+}
+
+bool readRect(BinaryReader& reader, ChunkRect& rect) {
+    reader.read(rect.mMinX);
+    reader.read(rect.mMaxX);
+    reader.read(rect.mMinZ);
+    reader.read(rect.mMaxZ);
+    return reader.ok();
+}
+
+void writeKey(BinaryWriter& writer, uint64_t key) { writer.write(key); }
+void writeKey(BinaryWriter& writer, SectionKey const& key) {
+    writer.write(key.first);
+    writer.write(key.second);
+}
 
-bool LandDimensionChunkMap::hasChunk(LandDimid dimid, ChunkID chunkid) const {
-    if (!mMap.contains(dimid)) {
+bool readKey(BinaryReader& reader, uint64_t& key) { return reader.read(key); }
+bool readKey(BinaryReader& reader, SectionKey& key) { return reader.read(key.first) && reader.read(key.second); }
+
+template <typename Map>
+void writeBuckets(BinaryWriter& writer, Map const& buckets) {
+    writer.write(static_cast<uint64_t>(buckets.size()));
+    for (auto const& [key, bucket] : buckets) {
+        writeKey(writer, key);
+        writer.write(static_cast<uint64_t>(bucket.size()));
+        for (auto const& e : bucket) {
+            writeEntry(writer, e);
+        }
+    }
+}
+
+template <typename Map>
+bool readBuckets(BinaryReader& reader, Map& buckets) {
+    uint64_t count{0};
+    if (!reader.readCount(count)) {
         return false;
     }
-    return mMap.at(dimid).has_key(chunkid);
+    for (uint64_t i = 0; i < count; ++i) {
+        typename Map::key_type key{};
+        uint64_t               size{0};
+        if (!readKey(reader, key) || !reader.readCount(size)) {
+            return false;
+        }
+        auto& bucket = buckets[key];
+        bucket.resize(static_cast<size_t>(size));
+        for (auto& e : bucket) {
+            if (!readEntry(reader, e)) {
+                return false;
+            }
+        }
+    }
+    return true;
 }
 
-bool LandDimensionChunkMap::hasLand(LandDimid dimid, LandID landid) const {
-    if (!mMap.contains(dimid)) {
+void writeRegion(BinaryWriter& writer, Region const& region) {
+    writeBuckets(writer, region.mChunks);
+    writeBuckets(writer, region.mMortonChunks);
+    writeBuckets(writer, region.mSections);
+
+    writer.write(static_cast<uint64_t>(region.mSectioned.size()));
+    for (auto const& [chunkId, count] : region.mSectioned) {
+        writer.write(chunkId);
+        writer.write(count);
+    }
+    for (auto row : region.mOccupancy.mRows) {
+        writer.write(row);
+    }
+}
+
+bool readRegion(BinaryReader& reader, Region& region) {
+    if (!readBuckets(reader, region.mChunks) || !readBuckets(reader, region.mMortonChunks)
+        || !readBuckets(reader, region.mSections)) {
         return false;
     }
-    return mMap.at(dimid).has_value(landid);
+
+    uint64_t count{0};
+    if (!reader.readCount(count)) {
+        return false;
+    }
+    for (uint64_t i = 0; i < count; ++i) {
+        ChunkID chunkId{0};
+        int     sectioned{0};
+        reader.read(chunkId);
+        reader.read(sectioned);
+        region.mSectioned[chunkId] = sectioned;
+    }
+    for (auto& row : region.mOccupancy.mRows) {
+        reader.read(row);
+    }
+    return reader.ok();
+}
+
+void writeDimension(BinaryWriter& writer, DimensionIndex const& dim) {
+    writer.write(static_cast<uint64_t>(dim.mRegions.size()));
+    for (auto const& [key, region] : dim.mRegions) {
+        writer.write(key);
+        writeRegion(writer, *region);
+    }
+
+    writer.write(static_cast<uint64_t>(dim.mLands.size()));
+    for (auto const& [landId, record] : dim.mLands) {
+        writer.write(landId);
+        writeRect(writer, record.mRect);
+        writer.write(record.mMinSection);
+        writer.write(record.mMaxSection);
+        writer.write(static_cast<uint8_t>(record.mLarge | record.mIs3D << 1));
+    }
+
+    static LargeLandList const empty{};
+    auto const&                list = dim.mLarge ? *dim.mLarge : empty;
+    writer.write(list.mMaxSpanX);
+    writer.write(static_cast<uint64_t>(list.mEntries.size()));
+    for (auto const& e : list.mEntries) {
+        writer.write(e.mLandId);
+        writer.write(e.mLevel);
+        writer.write(e.mAABB.min.x);
+        writer.write(e.mAABB.min.y);
+        writer.write(e.mAABB.min.z);
+        writer.write(e.mAABB.max.x);
+        writer.write(e.mAABB.max.y);
+        writer.write(e.mAABB.max.z);
+        writer.write(static_cast<uint8_t>(e.mIs3D));
+        writeRect(writer, e.mRect);
+    }
 }
 
-LandDimensionChunkMap::LandSet const* LandDimensionChunkMap::queryLand(LandDimid dimId, ChunkID chunkId) const {
+bool readDimension(BinaryReader& reader, DimensionIndex& dim) {
+    uint64_t count{0};
+    if (!reader.readCount(count)) {
+        return false;
+    }
+    for (uint64_t i = 0; i < count; ++i) {
+        ChunkID key{0};
+        if (!reader.read(key)) {
+            return false;
+        }
+        auto [rx, rz] = ChunkEncoder::decode(key);
+        if (!readRegion(reader, dim.mutableRegion(rx << Region::Shift, rz << Region::Shift))) {
+            return false;
+        }
+    }
+
+    if (!reader.readCount(count)) {
+        return false;
+    }
+    for (uint64_t i = 0; i < count; ++i) {
+        LandID     landId{0};
+        LandRecord record{};
+        uint8_t    flags{0};
+        reader.read(landId);
+        readRect(reader, record.mRect);
+        reader.read(record.mMinSection);
+        reader.read(record.mMaxSection);
+        reader.read(flags);
+        record.mLarge      = flags & 1;
+        record.mIs3D       = flags >> 1 & 1;
+        dim.mLands[landId] = record;
+    }
+
+    int maxSpanX{0};
+    if (!reader.read(maxSpanX) || !reader.readCount(count)) {
+        return false;
+    }
+    if (count == 0) {
+        return reader.ok();
+    }
+    auto& list     = dim.mutableLarge();
+    list.mMaxSpanX = maxSpanX;
+    list.mEntries.resize(static_cast<size_t>(count));
+    for (auto& e : list.mEntries) {
+        uint8_t is3D{0};
+        reader.read(e.mLandId);
+        reader.read(e.mLevel);
+        reader.read(e.mAABB.min.x);
+        reader.read(e.mAABB.min.y);
+        reader.read(e.mAABB.min.z);
+        reader.read(e.mAABB.max.x);
+        reader.read(e.mAABB.max.y);
+        reader.read(e.mAABB.max.z);
+        reader.read(is3D);
+        readRect(reader, e.mRect);
+        e.mIs3D = is3D != 0;
+    }
+    return reader.ok();
+}
+
+} // namespace
+
+LandDimensionChunkMap::DimensionIndex::DimensionIndex(DimensionIndex const& other)
+: mRegions(other.mRegions),
+  mLands(other.mLands),
+  mLarge(other.mLarge) {}
+
+LandDimensionChunkMap::DimensionIndex&
+LandDimensionChunkMap::DimensionIndex::operator=(DimensionIndex const& other) {
+    mRegions = other.mRegions;
+    mLands   = other.mLands;
+    mLarge   = other.mLarge;
+    mOwnedRegions.clear();
+    mOwnsLarge = false;
+    return *this;
+}
+
+LandDimensionChunkMap::Region const* LandDimensionChunkMap::DimensionIndex::findRegion(int chunkX, int chunkZ) const {
+    auto region = mRegions.find(Region::keyOf(chunkX, chunkZ));
+    return region ? region->get() : nullptr;
+}
+
+LandDimensionChunkMap::Region& LandDimensionChunkMap::DimensionIndex::mutableRegion(int chunkX, int chunkZ) {
+    auto  key    = Region::keyOf(chunkX, chunkZ);
+    auto& region = mRegions[key];
+    if (!region) {
+        region = std::make_shared<Region>();
+        mOwnedRegions.insert(key);
+    } else if (mOwnedRegions.insert(key).second) {
+        region = std::make_shared<Region>(*region); // 与其它快照共享，先复制再修改
+    }
+    return *region;
+}
+
+void LandDimensionChunkMap::DimensionIndex::eraseRegion(int chunkX, int chunkZ) {
+    auto key = Region::keyOf(chunkX, chunkZ);
+    mRegions.erase(key);
+    mOwnedRegions.erase(key);
+}
+
+LandDimensionChunkMap::LargeLandList& LandDimensionChunkMap::DimensionIndex::mutableLarge() {
+    if (!mLarge) {
+        mLarge = std::make_shared<LargeLandList>();
+    } else if (!mOwnsLarge) {
+        mLarge = std::make_shared<LargeLandList>(*mLarge);
+    }
+    mOwnsLarge = true;
+    return *mLarge;
+}
+
+LandDimensionChunkMap::LandDimensionChunkMap() = default;
+LandDimensionChunkMap::LandDimensionChunkMap(Options options) : mOptions(options) {}
+
+LandDimensionChunkMap::DimensionIndex const* LandDimensionChunkMap::_find(LandDimid dimId) const {
+    if (dimId >= 0 && dimId < VanillaDimensionCount) {
+        auto& dim = mVanilla[dimId];
+        return dim.mLands.empty() ? nullptr : &dim;
+    }
     auto iter = mMap.find(dimId);
-    if (iter == mMap.end()) {
+    return iter == mMap.end() ? nullptr : &iter->second;
+}
+
+LandDimensionChunkMap::DimensionIndex* LandDimensionChunkMap::_find(LandDimid dimId) {
+    return const_cast<DimensionIndex*>(std::as_const(*this)._find(dimId));
+}
+
+LandDimensionChunkMap::DimensionIndex& LandDimensionChunkMap::_getOrCreate(LandDimid dimId) {
+    if (dimId >= 0 && dimId < VanillaDimensionCount) {
+        return mVanilla[dimId];
+    }
+    return mMap[dimId];
+}
+
+LandDimensionChunkMap::Options const& LandDimensionChunkMap::getOptions() const { return mOptions; }
+
+bool LandDimensionChunkMap::hasDimension(LandDimid dimid) const { return _find(dimid) != nullptr; }
+
+bool LandDimensionChunkMap::hasChunk(LandDimid dimid, int chunkX, int chunkZ) const {
+    return queryLand(dimid, chunkX, chunkZ) != nullptr;
+}
+
+bool LandDimensionChunkMap::isChunkOccupied(LandDimid dimId, int chunkX, int chunkZ) const {
+    if (isChunkMarked(dimId, chunkX, chunkZ)) {
+        return true;
+    }
+    auto dim = _find(dimId);
+    if (!dim || !dim->mLarge || dim->mLarge->mEntries.empty()) {
+        return false;
+    }
+    bool occupied = false;
+    forEachLargeLand(dimId, chunkX, chunkX, chunkZ, chunkZ, [&](LargeLandEntry const&) { occupied = true; });
+    return occupied;
+}
+
+bool LandDimensionChunkMap::isChunkMarked(LandDimid dimId, int chunkX, int chunkZ) const {
+    auto dim = _find(dimId);
+    if (!dim) {
+        return false;
+    }
+    auto region = dim->findRegion(chunkX, chunkZ);
+    return region && region->mOccupancy.test(chunkX, chunkZ);
+}
+
+void LandDimensionChunkMap::_unmarkChunkIfEmpty(Region& region, int chunkX, int chunkZ) const {
+    if (region.mSectioned.contains(ChunkEncoder::encode(chunkX, chunkZ))) {
+        return;
+    }
+    bool const hasColumn = mOptions.mMortonOrder
+                             ? region.mMortonChunks.contains(MortonEncoder::encode(chunkX, chunkZ))
+                             : region.mChunks.contains(ChunkEncoder::encode(chunkX, chunkZ));
+    if (!hasColumn) {
+        region.mOccupancy.reset(chunkX, chunkZ); // 分区位图清空后由调用方释放分区
+    }
+}
+
+bool LandDimensionChunkMap::hasLand(LandDimid dimid, LandID landid) const {
+    auto dim = _find(dimid);
+    return dim && dim->mLands.contains(landid);
+}
+
+LandDimensionChunkMap::ChunkBucket const*
+LandDimensionChunkMap::queryLand(LandDimid dimId, int chunkX, int chunkZ) const {
+    auto dim = _find(dimId);
+    if (!dim) {
         return nullptr;
     }
-    auto& chunkMap = iter->second.forward_map();
-    auto  iter2    = chunkMap.find(chunkId);
-    if (iter2 == chunkMap.end()) {
+    auto region = dim->findRegion(chunkX, chunkZ);
+    if (!region) {
         return nullptr;
     }
-    return &iter2->second;
+    if (mOptions.mMortonOrder) {
+        auto iter = region->mMortonChunks.find(MortonEncoder::encode(chunkX, chunkZ));
+        return iter == region->mMortonChunks.end() ? nullptr : &iter->second;
+    }
+    auto iter = region->mChunks.find(ChunkEncoder::encode(chunkX, chunkZ));
+    return iter == region->mChunks.end() ? nullptr : &iter->second;
 }
 
-LandDimensionChunkMap::ChunkSet const* LandDimensionChunkMap::queryChunk(LandDimid dimId, LandID landId) const {
-    auto iter = mMap.find(dimId);
-    if (iter == mMap.end()) {
+LandDimensionChunkMap::ChunkBucket const*
+LandDimensionChunkMap::querySection(LandDimid dimId, int chunkX, int chunkZ, int sectionY) const {
+    auto dim = _find(dimId);
+    if (!dim) {
+        return nullptr;
+    }
+    auto region = dim->findRegion(chunkX, chunkZ);
+    if (!region) {
         return nullptr;
     }
-    auto& landMap = iter->second.reverse_map();
-    auto  iter2   = landMap.find(landId);
-    if (iter2 == landMap.end()) {
+    auto iter = region->mSections.find(SectionKey{ChunkEncoder::encode(chunkX, chunkZ), sectionY});
+    if (iter == region->mSections.end()) {
+        return nullptr;
+    }
+    return &iter->second;
+}
+
+LandDimensionChunkMap::LandRecord const* LandDimensionChunkMap::queryRecord(LandDimid dimId, LandID landId) const {
+    auto dim = _find(dimId);
+    if (!dim) {
         return nullptr;
     }
-    return &iter2->second;
+    return dim->mLands.find(landId);
+}
+
+bool LandDimensionChunkMap::_isLarge(ChunkRect const& rect) const {
+    return mOptions.mLargeLandChunkThreshold > 0 && rect.count() > mOptions.mLargeLandChunkThreshold;
+}
+
+void LandDimensionChunkMap::_registerChunk(
+    Region&           region,
+    LandRecord const& record,
+    ChunkEntry        entry,
+    int               x,
+    int               z
+) const {
+    auto chunkId = ChunkEncoder::encode(x, z);
+    region.mOccupancy.set(x, z);
+
+    if (!record.isSectioned()) {
+        if (mOptions.mMortonOrder) {
+            insertSorted(region.mMortonChunks[MortonEncoder::encode(x, z)], entry);
+        } else {
+            insertSorted(region.mChunks[chunkId], entry);
+        }
+        return;
+    }
+    ++region.mSectioned[chunkId];
+    for (int sy = record.mMinSection; sy <= record.mMaxSection; ++sy) {
+        entry.mFirstSection = sy == record.mMinSection;
+        insertSorted(region.mSections[SectionKey{chunkId, sy}], entry);
+    }
+}
+
+void LandDimensionChunkMap::_unregisterChunk(
+    Region&           region,
+    LandRecord const& record,
+    LandID            landId,
+    int               x,
+    int               z
+) const {
+    auto chunkId = ChunkEncoder::encode(x, z);
+    if (!record.isSectioned()) {
+        if (mOptions.mMortonOrder) {
+            eraseEntry(region.mMortonChunks, MortonEncoder::encode(x, z), landId);
+        } else {
+            eraseEntry(region.mChunks, chunkId, landId);
+        }
+    } else {
+        if (auto iter = region.mSectioned.find(chunkId); iter != region.mSectioned.end() && --iter->second <= 0) {
+            region.mSectioned.erase(iter);
+        }
+        for (int sy = record.mMinSection; sy <= record.mMaxSection; ++sy) {
+            eraseEntry(region.mSections, SectionKey{chunkId, sy}, landId);
+        }
+    }
+    _unmarkChunkIfEmpty(region, x, z);
+}
+
+void LandDimensionChunkMap::_updateChunk(
+    Region&           region,
+    LandRecord const& record,
+    ChunkEntry const& entry,
+    int               x,
+    int               z
+) const {
+    auto chunkId = ChunkEncoder::encode(x, z);
+    if (!record.isSectioned()) {
+        if (mOptions.mMortonOrder) {
+            updateEntry(region.mMortonChunks, MortonEncoder::encode(x, z), entry);
+        } else {
+            updateEntry(region.mChunks, chunkId, entry);
+        }
+        return;
+    }
+    for (int sy = record.mMinSection; sy <= record.mMaxSection; ++sy) {
+        updateEntry(region.mSections, SectionKey{chunkId, sy}, entry);
+    }
 }
 
 void LandDimensionChunkMap::addLand(std::shared_ptr<Land> const& land) {
-    auto landDimId = land->getDimensionId();
-    auto landId    = land->getId();
+    auto const& aabb = land->getAABB();
 
-    auto chunkIds =
-        land->getAABB().getChunks() | std::views::transform([](auto& c) { return ChunkEncoder::encode(c.x, c.z); });
+    auto& dim    = _getOrCreate(land->getDimensionId());
+    auto& record = dim.mLands[land->getId()];
 
-    auto& dim = mMap[landDimId];
-    for (auto chunkId : chunkIds) {
-        dim.insert(chunkId, landId);
+    record.mRect = {aabb.min.x >> 4, aabb.max.x >> 4, aabb.min.z >> 4, aabb.max.z >> 4};
+    record.mIs3D = land->is3D();
+    auto& rect   = record.mRect;
+
+    // 大型领地登记的区块数量与面积成正比，改为登记到独立的列表
+    if (_isLarge(rect)) {
+        record.mLarge = true;
+
+        auto& list = dim.mutableLarge();
+        auto  pos  = std::upper_bound(
+            list.mEntries.begin(),
+            list.mEntries.end(),
+            rect.mMinX,
+            [](int x, LargeLandEntry const& e) { return x < e.mRect.mMinX; }
+        );
+        list.mEntries.insert(pos, {land->getId(), land->getNestedLevel(), aabb, land->is3D(), rect});
+        list.mMaxSpanX = std::max(list.mMaxSpanX, rect.mMaxX - rect.mMinX);
+        return;
     }
+
+    if (land->is3D() && mOptions.mYSection) {
+        record.mMinSection = aabb.min.y >> 4;
+        record.mMaxSection = aabb.max.y >> 4;
+    }
+
+    forEachRegionIn(rect, [&](ChunkRect const& part) {
+        auto& region = dim.mutableRegion(part.mMinX, part.mMinZ);
+        for (int x = part.mMinX; x <= part.mMaxX; ++x) {
+            for (int z = part.mMinZ; z <= part.mMaxZ; ++z) {
+                _registerChunk(region, record, makeEntry(*land, rect, x, z), x, z);
+            }
+        }
+    });
 }
 
 void LandDimensionChunkMap::removeLand(std::shared_ptr<Land> const& land) {
-    auto landDimId = land->getDimensionId();
-    auto landId    = land->getId();
+    auto landId = land->getId();
+
+    auto dim = _find(land->getDimensionId());
+    if (!dim) return;
 
-    if (!mMap.contains(landDimId)) return;
+    // 使用登记时的记录，而非领地当前的范围(范围变更时领地已被修改)
+    auto found = dim->mLands.find(landId);
+    if (!found) return;
 
-    auto& dim         = mMap.at(landDimId);
-    auto  chunkSetPtr = queryChunk(landDimId, landId);
-    if (!chunkSetPtr) return;
+    auto const record = *found;
+    if (record.mLarge) {
+        auto& list = dim->mutableLarge();
+        std::erase_if(list.mEntries, [landId](LargeLandEntry const& e) { return e.mLandId == landId; });
 
-    auto chunkSet = *chunkSetPtr;
-    for (auto chunkId : chunkSet) {
-        dim.erase_value(chunkId, landId);
+        list.mMaxSpanX = 0;
+        for (auto const& e : list.mEntries) {
+            list.mMaxSpanX = std::max(list.mMaxSpanX, e.mRect.mMaxX - e.mRect.mMinX);
+        }
+    } else {
+        forEachRegionIn(record.mRect, [&](ChunkRect const& part) {
+            auto& region = dim->mutableRegion(part.mMinX, part.mMinZ);
+            for (int x = part.mMinX; x <= part.mMaxX; ++x) {
+                for (int z = part.mMinZ; z <= part.mMaxZ; ++z) {
+                    _unregisterChunk(region, record, landId, x, z);
+                }
+            }
+            if (region.mOccupancy.empty()) {
+                dim->eraseRegion(part.mMinX, part.mMinZ); // 分区内已无领地，释放分区
+            }
+        });
     }
+    dim->mLands.erase(landId);
 }
 
 void LandDimensionChunkMap::refreshRange(std::shared_ptr<Land> const& land) {
-    auto landDimId = land->getDimensionId();
-    if (!mMap.contains(landDimId)) {
+    auto dim = _find(land->getDimensionId());
+    if (!dim) {
+        return;
+    }
+    auto found = dim->mLands.findMutable(land->getId());
+    if (!found) {
+        addLand(land);
+        return;
+    }
+
+    auto const& aabb = land->getAABB();
+    auto&       prev = *found;
+
+    LandRecord next{{aabb.min.x >> 4, aabb.max.x >> 4, aabb.min.z >> 4, aabb.max.z >> 4}};
+    next.mIs3D = land->is3D();
+    if (next.mIs3D && mOptions.mYSection) {
+        next.mMinSection = aabb.min.y >> 4;
+        next.mMaxSection = aabb.max.y >> 4;
+    }
+
+    // 大型领地、高度段或 2D/3D 发生变化时，区块桶的归属或全部条目整体改变，回退到完整重建
+    if (prev.mLarge || _isLarge(next.mRect) || prev.mIs3D != next.mIs3D || prev.mMinSection != next.mMinSection
+        || prev.mMaxSection != next.mMaxSection) {
+        removeLand(land);
+        addLand(land);
+        return;
+    }
+
+    auto const oldRect = prev.mRect;
+    auto const newRect = next.mRect;
+    auto const landId  = land->getId();
+
+    // 仅处理新旧区块矩形的差集，耗时与变化的条带成正比而非领地面积
+    forEachInDifference(oldRect, newRect, [&](int x, int z) {
+        auto& region = dim->mutableRegion(x, z);
+        _unregisterChunk(region, prev, landId, x, z);
+        if (region.mOccupancy.empty()) {
+            dim->eraseRegion(x, z);
+        }
+    });
+    forEachInDifference(newRect, oldRect, [&](int x, int z) {
+        _registerChunk(dim->mutableRegion(x, z), next, makeEntry(*land, newRect, x, z), x, z);
+    });
+
+    // 交集内仅边界行列的列覆盖掩码与首区块标记可能变化，内部区块恒为全覆盖
+    int const minX = std::max(oldRect.mMinX, newRect.mMinX);
+    int const maxX = std::min(oldRect.mMaxX, newRect.mMaxX);
+    int const minZ = std::max(oldRect.mMinZ, newRect.mMinZ);
+    int const maxZ = std::min(oldRect.mMaxZ, newRect.mMaxZ);
+    if (minX <= maxX && minZ <= maxZ) {
+        std::array edgeX{oldRect.mMinX, oldRect.mMaxX, newRect.mMinX, newRect.mMaxX};
+        std::array edgeZ{oldRect.mMinZ, oldRect.mMaxZ, newRect.mMinZ, newRect.mMaxZ};
+        std::sort(edgeX.begin(), edgeX.end());
+        std::sort(edgeZ.begin(), edgeZ.end());
+        auto const edgeXEnd = std::unique(edgeX.begin(), edgeX.end());
+        auto const edgeZEnd = std::unique(edgeZ.begin(), edgeZ.end());
+
+        auto update = [&](int x, int z) {
+            _updateChunk(dim->mutableRegion(x, z), next, makeEntry(*land, newRect, x, z), x, z);
+        };
+        for (auto x = edgeX.begin(); x != edgeXEnd; ++x) {
+            if (*x < minX || *x > maxX) continue;
+            for (int z = minZ; z <= maxZ; ++z) {
+                update(*x, z);
+            }
+        }
+        for (auto z = edgeZ.begin(); z != edgeZEnd; ++z) {
+            if (*z < minZ || *z > maxZ) continue;
+            for (int x = minX; x <= maxX; ++x) {
+                if (std::find(edgeX.begin(), edgeXEnd, x) == edgeXEnd) {
+                    update(x, *z); // 边界列已在上方处理
+                }
+            }
+        }
+    }
+    prev = next;
+}
+
+void LandDimensionChunkMap::refreshLevel(std::shared_ptr<Land> const& land) {
+    auto landId = land->getId();
+    auto level  = land->getNestedLevel();
+
+    auto dim = _find(land->getDimensionId());
+    if (!dim) return;
+
+    auto found = dim->mLands.find(landId);
+    if (!found) return;
+
+    auto const& record = *found;
+    if (record.mLarge) {
+        for (auto& e : dim->mutableLarge().mEntries) {
+            if (e.mLandId == landId) {
+                e.mLevel = level;
+            }
+        }
         return;
     }
-    removeLand(land);
-    addLand(land);
+
+    forEachRegionIn(record.mRect, [&](ChunkRect const& part) {
+        auto& region = dim->mutableRegion(part.mMinX, part.mMinZ);
+        for (int x = part.mMinX; x <= part.mMaxX; ++x) {
+            for (int z = part.mMinZ; z <= part.mMaxZ; ++z) {
+                auto chunkId = ChunkEncoder::encode(x, z);
+                if (!record.isSectioned()) {
+                    if (mOptions.mMortonOrder) {
+                        resortEntry(region.mMortonChunks, MortonEncoder::encode(x, z), landId, level);
+                    } else {
+                        resortEntry(region.mChunks, chunkId, landId, level);
+                    }
+                    continue;
+                }
+                for (int sy = record.mMinSection; sy <= record.mMaxSection; ++sy) {
+                    resortEntry(region.mSections, SectionKey{chunkId, sy}, landId, level);
+                }
+            }
+        }
+    });
+}
+
+void LandDimensionChunkMap::_mergeDimension(DimensionIndex& dst, DimensionIndex&& src) {
+    for (auto const& [key, from] : src.mRegions) {
+        if (!dst.mRegions.contains(key)) {
+            dst.mRegions[key] = from;
+            if (src.mOwnedRegions.contains(key)) {
+                dst.mOwnedRegions.insert(key); // 转移独占权，src 随后即被丢弃
+            }
+            continue;
+        }
+        // 仅在 src 独占该分区时才可移出其内容，否则复制
+        auto region = src.mOwnedRegions.contains(key) ? std::move(*from) : Region{*from};
+
+        auto [rx, rz]  = ChunkEncoder::decode(key);
+        auto& target   = dst.mutableRegion(rx << Region::Shift, rz << Region::Shift);
+        mergeBuckets(target.mChunks, std::move(region.mChunks));
+        mergeBuckets(target.mMortonChunks, std::move(region.mMortonChunks));
+        mergeBuckets(target.mSections, std::move(region.mSections));
+        for (auto const& [chunkId, count] : region.mSectioned) {
+            target.mSectioned[chunkId] += count;
+        }
+        for (size_t i = 0; i < region.mOccupancy.mRows.size(); ++i) {
+            target.mOccupancy.mRows[i] |= region.mOccupancy.mRows[i];
+        }
+    }
+    src.mRegions = {};
+    src.mOwnedRegions.clear();
+
+    for (auto const& [landId, record] : src.mLands) {
+        dst.mLands.try_emplace(landId, record);
+    }
+
+    if (src.mLarge && !src.mLarge->mEntries.empty()) {
+        auto& list = dst.mutableLarge();
+        list.mEntries.insert(list.mEntries.end(), src.mLarge->mEntries.begin(), src.mLarge->mEntries.end());
+        std::stable_sort(
+            list.mEntries.begin(),
+            list.mEntries.end(),
+            [](LargeLandEntry const& a, LargeLandEntry const& b) { return a.mRect.mMinX < b.mRect.mMinX; }
+        );
+        list.mMaxSpanX = std::max(list.mMaxSpanX, src.mLarge->mMaxSpanX);
+    }
+}
+
+void LandDimensionChunkMap::merge(LandDimensionChunkMap&& other) {
+    for (LandDimid dimId = 0; dimId < VanillaDimensionCount; ++dimId) {
+        _mergeDimension(mVanilla[dimId], std::move(other.mVanilla[dimId]));
+    }
+    for (auto& [dimId, dim] : other.mMap) {
+        _mergeDimension(mMap[dimId], std::move(dim));
+    }
+    other.mMap.clear();
+}
+
+void LandDimensionChunkMap::serialize(BinaryWriter& writer) const {
+    writer.write(static_cast<uint8_t>(mOptions.mYSection));
+    writer.write(mOptions.mLargeLandChunkThreshold);
+    writer.write(static_cast<uint8_t>(mOptions.mMortonOrder));
+
+    uint64_t count = mMap.size();
+    for (auto const& dim : mVanilla) {
+        count += dim.mLands.empty() ? 0 : 1;
+    }
+    writer.write(count);
+
+    for (LandDimid dimId = 0; dimId < VanillaDimensionCount; ++dimId) {
+        if (!mVanilla[dimId].mLands.empty()) {
+            writer.write(dimId);
+            writeDimension(writer, mVanilla[dimId]);
+        }
+    }
+    for (auto const& [dimId, dim] : mMap) {
+        writer.write(dimId);
+        writeDimension(writer, dim);
+    }
+}
+
+bool LandDimensionChunkMap::deserialize(BinaryReader& reader) {
+    uint8_t ySection{0};
+    int64_t threshold{0};
+    uint8_t mortonOrder{0};
+    reader.read(ySection);
+    reader.read(threshold);
+    reader.read(mortonOrder);
+    if (!reader.ok() || (ySection != 0) != mOptions.mYSection || threshold != mOptions.mLargeLandChunkThreshold
+        || (mortonOrder != 0) != mOptions.mMortonOrder) {
+        return false; // 索引选项已变更
+    }
+
+    uint64_t count{0};
+    if (!reader.readCount(count)) {
+        return false;
+    }
+    for (uint64_t i = 0; i < count; ++i) {
+        LandDimid dimId{0};
+        if (!reader.read(dimId) || !readDimension(reader, _getOrCreate(dimId))) {
+            return false;
+        }
+    }
+    return reader.ok();
 }
 
 
-} // namespace land::internal
\ No newline at end of file
+} // namespace land::internal
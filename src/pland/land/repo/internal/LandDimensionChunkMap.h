@@ -1,10 +1,22 @@
 #pragma once
-#include "BidirectionalMap.h"
 #include "ChunkEncoder.h"
+#include "CowShardedMap.h"
+#include "MortonEncoder.h"
 
 #include "pland/Global.h"
+#include "pland/aabb/LandAABB.h"
 
+#include "absl/container/btree_map.h"
 #include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/container/inlined_vector.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace land {
 class Land;
@@ -12,24 +24,192 @@ class Land;
 
 namespace land::internal {
 
+class BinaryWriter;
+class BinaryReader;
+
 
 /**
  * @brief 领地维度区块双向映射表
- *         / --> 区块 --> [领地]  # 查询领地
- * 维度 --|
- *        \ --> 领地 --> [区块]   # 查询区块
+ *         / --> 区块 --> [领地]          # 查询领地 (按嵌套层级降序)
+ *        |
+ * 维度 --|--> 区块 + 高度段 --> [领地]   # 查询3D领地 (可选，按 16 格高度分段)
+ *        |
+ *        |--> 区块占用位图                # 荒野快速判定 (32x32 区块分块，按需分配)
+ *        |
+ *        |--> 大型领地列表                # 超过区块数量阈值的领地不按区块登记
+ *        |
+ *         \ --> 领地 --> 区块矩形         # 查询区块
+ *
+ * 区块桶、高度段与占用位图按 32x32 区块聚合为分区，分区与领地记录均按分片写时复制，
+ * 复制索引(发布新快照)只复制分片指针，修改领地时仅复制其覆盖的分区与所在分片。
  */
 class LandDimensionChunkMap {
 public:
-    using TypedBidirectionalMap = BidirectionalMap<ChunkID, LandID>; // 区块 --> 领地
+    /**
+     * @brief 区块桶条目
+     * 领地与区块的交集必为矩形，因此 16x16 列覆盖掩码可分解为 X/Z 两个 16 位掩码的外积，
+     * 判断某列是否被覆盖只需两次位测试
+     * @note 条目压缩为 16 字节，内联桶(2 个条目)连同头部恰好 40 字节；嵌套层级受配置限制，int16 足够
+     */
+    struct ChunkEntry {
+        LandID   mLandId;           // 领地ID
+        int16_t  mLevel;            // 嵌套层级(缓存)
+        uint16_t mMaskX;            // 区块内 X 方向列覆盖掩码
+        uint16_t mMaskZ;            // 区块内 Z 方向列覆盖掩码
+        bool     mIs3D : 1;         // 是否为3D领地(需额外判断Y轴)
+        bool     mFirstX : 1;       // 是否为领地 X 方向的首个区块
+        bool     mFirstZ : 1;       // 是否为领地 Z 方向的首个区块
+        bool     mFirstSection : 1; // 是否为领地的首个高度段(未分段时恒为 true)
+
+        [[nodiscard]] bool hasColumn(int localX, int localZ) const {
+            return (mMaskX >> localX & 1) && (mMaskZ >> localZ & 1);
+        }
+
+        [[nodiscard]] bool isFullyCovered() const { return mMaskX == 0xFFFF && mMaskZ == 0xFFFF; }
+    };
+    static_assert(sizeof(ChunkEntry) == 16);
+
+    // 绝大多数区块仅有 1~2 个领地，内联存储避免堆分配
+    using ChunkBucket = absl::InlinedVector<ChunkEntry, 2>; // 区块 --> 领地 (最深层在前)
+    using SectionKey  = std::pair<ChunkID, int>;            // 区块 + 高度段(y >> 4)
+
+    /**
+     * @brief 区块矩形(闭区间)
+     */
+    struct ChunkRect {
+        int mMinX; // 最小区块 X
+        int mMaxX; // 最大区块 X
+        int mMinZ; // 最小区块 Z
+        int mMaxZ; // 最大区块 Z
+
+        [[nodiscard]] bool intersects(int minX, int maxX, int minZ, int maxZ) const {
+            return mMinX <= maxX && mMaxX >= minX && mMinZ <= maxZ && mMaxZ >= minZ;
+        }
+
+        [[nodiscard]] int64_t count() const { return static_cast<int64_t>(mMaxX - mMinX + 1) * (mMaxZ - mMinZ + 1); }
+    };
+
+    /**
+     * @brief 大型领地条目
+     */
+    struct LargeLandEntry {
+        LandID    mLandId; // 领地ID
+        int       mLevel;  // 嵌套层级(缓存)
+        LandAABB  mAABB;   // 领地范围
+        bool      mIs3D;   // 是否为3D领地
+        ChunkRect mRect;   // 区块范围
+    };
+
+    /**
+     * @brief 大型领地列表
+     * 按最小区块 X 升序排列，配合最大 X 跨度剪枝：
+     * 与 [minX, maxX] 相交的条目必然满足 mRect.mMinX ∈ [minX - mMaxSpanX, maxX]
+     */
+    struct LargeLandList {
+        std::vector<LargeLandEntry> mEntries;     // 领地条目
+        int                         mMaxSpanX{0}; // 最大 X 跨度(区块)
+    };
+
+    /**
+     * @brief 领地反向记录
+     * 领地覆盖的区块必为矩形，仅记录矩形范围而非逐个区块
+     */
+    struct LandRecord {
+        ChunkRect mRect{};        // 登记时的区块范围
+        int       mMinSection{0};  // 最低高度段
+        int       mMaxSection{-1}; // 最高高度段(小于 mMinSection 表示未分段)
+        bool      mLarge{false};   // 是否登记在大型领地列表
+        bool      mIs3D{false};    // 登记时是否为3D领地(条目缓存了该标记)
+
+        [[nodiscard]] bool isSectioned() const { return mMinSection <= mMaxSection; }
+    };
+
+    /**
+     * @brief 区块占用位图分块
+     * 覆盖 32x32 个区块，每区块 1 位，表示该区块是否按区块登记了领地(不含大型领地)
+     */
+    struct OccupancyTile {
+        inline static constexpr int Shift = 5;                // 分块边长(区块) = 1 << Shift
+        inline static constexpr int Mask  = (1 << Shift) - 1; // 分块内坐标掩码
+
+        std::array<uint32_t, 1 << Shift> mRows{}; // 按 Z 分行，每行以位表示 X
+
+        [[nodiscard]] bool test(int chunkX, int chunkZ) const { return mRows[chunkZ & Mask] >> (chunkX & Mask) & 1; }
+
+        void set(int chunkX, int chunkZ) { mRows[chunkZ & Mask] |= 1u << (chunkX & Mask); }
+
+        void reset(int chunkX, int chunkZ) { mRows[chunkZ & Mask] &= ~(1u << (chunkX & Mask)); }
+
+        [[nodiscard]] bool empty() const {
+            return std::all_of(mRows.begin(), mRows.end(), [](uint32_t row) { return row == 0; });
+        }
+
+        [[nodiscard]] static ChunkID keyOf(int chunkX, int chunkZ) {
+            return ChunkEncoder::encode(chunkX >> Shift, chunkZ >> Shift);
+        }
+    };
+
+    /**
+     * @brief 区块分区
+     * 以 32x32 个区块为单位聚合区块桶与占用位图，作为写时复制的最小单位：
+     * 修改领地时只复制其覆盖的分区，其余分区在新旧快照间共享
+     */
+    struct Region {
+        inline static constexpr int Shift = OccupancyTile::Shift; // 分区边长(区块) = 1 << Shift
+
+        absl::flat_hash_map<ChunkID, ChunkBucket>    mChunks;       // 区块 --> 领地 (2D 领地及未分段的3D领地)
+        absl::btree_map<MortonKey, ChunkBucket>      mMortonChunks; // 同上，Morton 有序存储模式
+        absl::flat_hash_map<SectionKey, ChunkBucket> mSections;     // 区块 + 高度段 --> 3D领地
+        absl::flat_hash_map<ChunkID, int>            mSectioned;    // 区块 --> 分段登记的3D领地数量
+        OccupancyTile                                mOccupancy;    // 区块占用位图
+
+        [[nodiscard]] static ChunkID keyOf(int chunkX, int chunkZ) { return OccupancyTile::keyOf(chunkX, chunkZ); }
+    };
+
+    /**
+     * @brief 维度索引
+     * 分区与领地记录均按分片写时复制，复制整个维度索引的开销与分片数量成正比，而非领地数量
+     * @note 复制得到的副本不独占任何分区，首次修改时再复制
+     */
+    struct DimensionIndex {
+        using RegionPtr = std::shared_ptr<Region>;
+
+        CowShardedMap<ChunkID, RegionPtr> mRegions;          // 分区键 --> 分区
+        CowShardedMap<LandID, LandRecord> mLands;            // 领地 --> 区块
+        std::shared_ptr<LargeLandList>    mLarge;            // 大型领地(为空表示没有大型领地)
+        absl::flat_hash_set<ChunkID>      mOwnedRegions;     // 本副本独占、可原地修改的分区
+        bool                              mOwnsLarge{false}; // 本副本是否独占大型领地列表
+
+        DimensionIndex() = default;
+        DimensionIndex(DimensionIndex const& other);
+        DimensionIndex& operator=(DimensionIndex const& other);
+        DimensionIndex(DimensionIndex&&) noexcept            = default;
+        DimensionIndex& operator=(DimensionIndex&&) noexcept = default;
+
+        [[nodiscard]] Region const* findRegion(int chunkX, int chunkZ) const;
+        [[nodiscard]] Region&       mutableRegion(int chunkX, int chunkZ);
+        void                        eraseRegion(int chunkX, int chunkZ);
+
+        [[nodiscard]] LargeLandList& mutableLarge();
+    };
+
+    // 原版维度(0~2)使用定长数组，其余维度回退到哈希表
+    inline static constexpr LandDimid VanillaDimensionCount = 3;
 
-    using DimensionMap = absl::flat_hash_map<LandDimid, TypedBidirectionalMap>;
+    using VanillaDimensions = std::array<DimensionIndex, VanillaDimensionCount>;
+    using DimensionMap      = absl::flat_hash_map<LandDimid, DimensionIndex>;
 
-    using ChunkSet = TypedBidirectionalMap::KeysSet;
-    using LandSet  = TypedBidirectionalMap::ValuesSet;
+    struct Options {
+        bool    mYSection{true};                // 3D 领地按高度分段索引
+        int64_t mLargeLandChunkThreshold{4096}; // 超过该区块数量的领地登记为大型领地(<=0 表示禁用)
+        bool    mMortonOrder{false};            // 区块桶使用 Morton 键有序存储(矩形查询转为区间扫描)
+    };
 
 public:
     LandDimensionChunkMap();
+    explicit LandDimensionChunkMap(Options options);
+
+    [[nodiscard]] Options const& getOptions() const;
 
     /**
      * @brief 查询维度是否存在
@@ -39,7 +219,18 @@ class LandDimensionChunkMap {
     /**
      * @brief 查询区块是否存在
      */
-    [[nodiscard]] bool hasChunk(LandDimid dimId, ChunkID chunkId) const;
+    [[nodiscard]] bool hasChunk(LandDimid dimId, int chunkX, int chunkZ) const;
+
+    /**
+     * @brief 查询区块内是否登记有任意领地(含分段登记的3D领地与大型领地)
+     */
+    [[nodiscard]] bool isChunkOccupied(LandDimid dimId, int chunkX, int chunkZ) const;
+
+    /**
+     * @brief 查询区块占用位图
+     * @note 仅反映按区块登记的领地(列结构与高度分段)，不含大型领地；未置位时无需再查询区块桶
+     */
+    [[nodiscard]] bool isChunkMarked(LandDimid dimId, int chunkX, int chunkZ) const;
 
     /**
      * @brief 查询领地是否存在
@@ -48,22 +239,221 @@ class LandDimensionChunkMap {
 
     /**
      * @brief 查询某个区块下所有的领地
+     * @note 结果按嵌套层级降序排列，点查询命中的第一个领地即为最深层领地
+     * @note 启用高度分段时，结果不包含3D领地，需配合 querySection 使用
+     */
+    [[nodiscard]] ChunkBucket const* queryLand(LandDimid dimId, int chunkX, int chunkZ) const;
+
+    /**
+     * @brief 查询某个区块高度段下所有的3D领地
+     * @note 结果按嵌套层级降序排列
+     */
+    [[nodiscard]] ChunkBucket const* querySection(LandDimid dimId, int chunkX, int chunkZ, int sectionY) const;
+
+    /**
+     * @brief 遍历与区块矩形(及高度段范围)相交的所有领地
+     * @note 每个领地仅回调一次：领地只在 "其与查询范围交集" 的首个区块(及首个高度段)中上报，
+     *       该判定仅依赖条目上的首区块标记，无需额外的去重容器，也不写入任何共享状态
+     * @param fn bool(LandID)，返回 false 停止遍历
+     * @return 是否完整遍历(未被中止)
      */
-    [[nodiscard]] LandSet const* queryLand(LandDimid dimId, ChunkID chunkId) const;
+    template <typename Fn>
+    bool forEachLandIn(
+        LandDimid dimId,
+        int       minChunkX,
+        int       maxChunkX,
+        int       minChunkZ,
+        int       maxChunkZ,
+        int       minSection,
+        int       maxSection,
+        Fn&&      fn
+    ) const {
+        auto dim = _find(dimId);
+        if (!dim) {
+            return true;
+        }
+
+        auto visit = [&](ChunkBucket const& bucket, int x, int z, int sy) -> bool {
+            for (auto const& e : bucket) {
+                if ((x == minChunkX || e.mFirstX) && (z == minChunkZ || e.mFirstZ)
+                    && (sy == minSection || e.mFirstSection)) {
+                    if (!fn(e.mLandId)) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        };
+
+        // 按分区遍历，不存在的分区整块跳过
+        for (int rx = minChunkX >> Region::Shift; rx <= maxChunkX >> Region::Shift; ++rx) {
+            for (int rz = minChunkZ >> Region::Shift; rz <= maxChunkZ >> Region::Shift; ++rz) {
+                auto const* region = dim->findRegion(rx << Region::Shift, rz << Region::Shift);
+                if (!region) {
+                    continue;
+                }
+                int const x0 = std::max(minChunkX, rx << Region::Shift);
+                int const x1 = std::min(maxChunkX, (rx << Region::Shift) + OccupancyTile::Mask);
+                int const z0 = std::max(minChunkZ, rz << Region::Shift);
+                int const z1 = std::min(maxChunkZ, (rz << Region::Shift) + OccupancyTile::Mask);
+                if (!_forEachBucketIn(*region, x0, x1, z0, z1, minSection, maxSection, visit)) {
+                    return false;
+                }
+            }
+        }
+
+        // 大型领地在列表中仅出现一次
+        bool completed = true;
+        forEachLargeLand(dimId, minChunkX, maxChunkX, minChunkZ, maxChunkZ, [&](LargeLandEntry const& e) {
+            if (completed && !fn(e.mLandId)) {
+                completed = false;
+            }
+        });
+        return completed;
+    }
 
     /**
-     * @brief 查询某个领地下所有的区块
+     * @brief 遍历与区块矩形相交的大型领地
      */
-    [[nodiscard]] ChunkSet const* queryChunk(LandDimid dimId, LandID landId) const;
+    template <typename Fn>
+    void forEachLargeLand(LandDimid dimId, int minChunkX, int maxChunkX, int minChunkZ, int maxChunkZ, Fn&& fn) const {
+        auto dim = _find(dimId);
+        if (!dim || !dim->mLarge) {
+            return;
+        }
+        auto const& list  = *dim->mLarge;
+        auto        first = std::lower_bound(
+            list.mEntries.begin(),
+            list.mEntries.end(),
+            minChunkX - list.mMaxSpanX,
+            [](LargeLandEntry const& e, int x) { return e.mRect.mMinX < x; }
+        );
+        for (; first != list.mEntries.end() && first->mRect.mMinX <= maxChunkX; ++first) {
+            if (first->mRect.intersects(minChunkX, maxChunkX, minChunkZ, maxChunkZ)) {
+                fn(*first);
+            }
+        }
+    }
+
+    /**
+     * @brief 查询某个领地的登记记录(区块范围)
+     */
+    [[nodiscard]] LandRecord const* queryRecord(LandDimid dimId, LandID landId) const;
 
     void addLand(std::shared_ptr<Land> const& land);
 
     void removeLand(std::shared_ptr<Land> const& land);
 
+    /**
+     * @brief 同步领地范围
+     * @note 仅增删新旧区块矩形差集中的条带、并修正交集边界行列的条目，耗时与范围变化量成正比
+     */
     void refreshRange(std::shared_ptr<Land> const& land);
 
+    /**
+     * @brief 同步领地嵌套层级，维持区块桶的排序
+     */
+    void refreshLevel(std::shared_ptr<Land> const& land);
+
+    /**
+     * @brief 合并另一份索引(用于分片并行构建)
+     * @note 两份索引的选项必须一致，且登记的领地互不重复；合并后 other 处于有效但未指定的状态
+     */
+    void merge(LandDimensionChunkMap&& other);
+
+    /**
+     * @brief 序列化索引(用于持久化快照)
+     */
+    void serialize(BinaryWriter& writer) const;
+
+    /**
+     * @brief 从序列化数据恢复索引
+     * @note 需在空索引上调用
+     * @return 数据损坏或与当前选项不一致时返回 false，此时索引内容未定义，应丢弃
+     */
+    [[nodiscard]] bool deserialize(BinaryReader& reader);
+
 private:
-    DimensionMap mMap;
+    [[nodiscard]] DimensionIndex const* _find(LandDimid dimId) const;
+    [[nodiscard]] DimensionIndex*       _find(LandDimid dimId);
+    [[nodiscard]] DimensionIndex&       _getOrCreate(LandDimid dimId);
+
+    [[nodiscard]] bool _isLarge(ChunkRect const& rect) const;
+
+    void _unmarkChunkIfEmpty(Region& region, int chunkX, int chunkZ) const;
+
+    // 以下方法操作的区块必须位于给定分区内
+    void _registerChunk(Region& region, LandRecord const& record, ChunkEntry entry, int chunkX, int chunkZ) const;
+    void _unregisterChunk(Region& region, LandRecord const& record, LandID landId, int chunkX, int chunkZ) const;
+    void _updateChunk(Region& region, LandRecord const& record, ChunkEntry const& entry, int chunkX, int chunkZ) const;
+
+    static void _mergeDimension(DimensionIndex& dst, DimensionIndex&& src);
+
+    /**
+     * @brief 遍历分区内与区块矩形(及高度段范围)相交的区块桶
+     * @note 矩形必须位于该分区内
+     */
+    template <typename Visit>
+    bool _forEachBucketIn(
+        Region const& region,
+        int           minChunkX,
+        int           maxChunkX,
+        int           minChunkZ,
+        int           maxChunkZ,
+        int           minSection,
+        int           maxSection,
+        Visit&        visit
+    ) const {
+        if (mOptions.mMortonOrder) {
+            // 矩形在 Morton 键空间上分裂为若干连续区间，跳出矩形时借助 BIGMIN 定位下一个区间的起点
+            auto const zmin = MortonEncoder::encode(minChunkX, minChunkZ);
+            auto const zmax = MortonEncoder::encode(maxChunkX, maxChunkZ);
+
+            auto const& chunks = region.mMortonChunks;
+            for (auto iter = chunks.lower_bound(zmin); iter != chunks.end() && iter->first <= zmax;) {
+                if (!MortonEncoder::inRange(iter->first, zmin, zmax)) {
+                    iter = chunks.lower_bound(MortonEncoder::bigMin(iter->first, zmin, zmax));
+                    continue;
+                }
+                auto [x, z] = MortonEncoder::decode(iter->first);
+                if (!visit(iter->second, x, z, minSection)) {
+                    return false;
+                }
+                ++iter;
+            }
+        } else if (!region.mChunks.empty()) {
+            for (int x = minChunkX; x <= maxChunkX; ++x) {
+                for (int z = minChunkZ; z <= maxChunkZ; ++z) {
+                    auto iter = region.mChunks.find(ChunkEncoder::encode(x, z));
+                    if (iter != region.mChunks.end() && !visit(iter->second, x, z, minSection)) {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        if (!region.mSections.empty()) {
+            for (int x = minChunkX; x <= maxChunkX; ++x) {
+                for (int z = minChunkZ; z <= maxChunkZ; ++z) {
+                    auto chunkId = ChunkEncoder::encode(x, z);
+                    if (!region.mSectioned.contains(chunkId)) {
+                        continue;
+                    }
+                    for (int sy = minSection; sy <= maxSection; ++sy) {
+                        auto iter = region.mSections.find(SectionKey{chunkId, sy});
+                        if (iter != region.mSections.end() && !visit(iter->second, x, z, sy)) {
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    Options           mOptions;
+    VanillaDimensions mVanilla; // 原版维度
+    DimensionMap      mMap;     // 自定义维度
 };
 
 } // namespace land::internal
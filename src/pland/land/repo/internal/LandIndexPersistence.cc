@@ -0,0 +1,138 @@
+#include "LandIndexPersistence.h"
+#include "BinaryStream.h"
+#include "LandDimensionChunkMap.h"
+
+#include "pland/land/repo/LandContext.h"
+
+#include "ll/api/io/FileUtils.h"
+
+#include <cstring>
+#include <string>
+#include <system_error>
+
+namespace land::internal {
+
+namespace {
+
+uint64_t hashBytes(uint64_t hash, std::string_view bytes) {
+    constexpr uint64_t WordMul   = 0x9E3779B97F4A7C15ull;
+    constexpr uint64_t BytePrime = 0x100000001B3ull;
+
+    // 按 8 字节分组混合，尾部逐字节 FNV-1a
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= bytes.size(); i += sizeof(uint64_t)) {
+        uint64_t word{0};
+        std::memcpy(&word, bytes.data() + i, sizeof(uint64_t));
+        hash  = (hash ^ word) * WordMul;
+        hash ^= hash >> 32;
+    }
+    for (; i < bytes.size(); ++i) {
+        hash = (hash ^ static_cast<uint8_t>(bytes[i])) * BytePrime;
+    }
+    return hash;
+}
+
+uint64_t hashLength(uint64_t hash, size_t length) {
+    return (hash ^ static_cast<uint64_t>(length)) * 0x100000001B3ull;
+}
+
+} // namespace
+
+void LandIndexPersistence::Fingerprint::update(std::string_view key, std::string_view value) {
+    // 混入长度，避免键值边界移动产生相同的字节序列
+    mHash = hashBytes(hashLength(mHash, key.size()), key);
+    mHash = hashBytes(hashLength(mHash, value.size()), value);
+    ++mCount;
+}
+
+uint64_t LandIndexPersistence::Fingerprint::value() const { return hashLength(mHash, mCount); }
+
+bool LandIndexPersistence::save(
+    std::filesystem::path const& file,
+    uint64_t                     fingerprint,
+    LandDimensionChunkMap const& map,
+    LevelTable const&            levels
+) {
+    std::string payload;
+    {
+        BinaryWriter writer{payload};
+        map.serialize(writer);
+        writer.write(static_cast<uint64_t>(levels.size()));
+        for (auto const& [landId, level] : levels) {
+            writer.write(landId);
+            writer.write(level);
+        }
+    }
+
+    std::string  buffer;
+    BinaryWriter writer{buffer};
+    writer.write(Magic);
+    writer.write(FormatVersion);
+    writer.write(static_cast<int32_t>(LandSchemaVersion));
+    writer.write(fingerprint);
+    writer.write(hashBytes(0, payload));
+    writer.write(std::string_view{payload});
+
+    auto temp = file;
+    temp += ".tmp";
+    if (!ll::file_utils::writeFile(temp, buffer, true)) {
+        return false;
+    }
+    std::error_code ec;
+    std::filesystem::rename(temp, file, ec);
+    return !ec;
+}
+
+bool LandIndexPersistence::load(
+    std::filesystem::path const& file,
+    uint64_t                     fingerprint,
+    LandDimensionChunkMap&       map,
+    LevelTable&                  levels
+) {
+    std::error_code ec;
+    if (!std::filesystem::exists(file, ec)) {
+        return false;
+    }
+    auto data = ll::file_utils::readFile(file, true);
+    std::filesystem::remove(file, ec); // 快照仅使用一次
+    if (!data) {
+        return false;
+    }
+
+    BinaryReader reader{*data};
+
+    uint32_t         magic{0};
+    uint32_t         version{0};
+    int32_t          schema{0};
+    uint64_t         storedFingerprint{0};
+    uint64_t         checksum{0};
+    std::string_view payload;
+    reader.read(magic);
+    reader.read(version);
+    reader.read(schema);
+    reader.read(storedFingerprint);
+    reader.read(checksum);
+    reader.read(payload);
+    if (!reader.ok() || magic != Magic || version != FormatVersion || schema != LandSchemaVersion
+        || storedFingerprint != fingerprint || checksum != hashBytes(0, payload)) {
+        return false;
+    }
+
+    BinaryReader body{payload};
+    if (!map.deserialize(body)) {
+        return false;
+    }
+    uint64_t count{0};
+    if (!body.readCount(count)) {
+        return false;
+    }
+    levels.resize(static_cast<size_t>(count));
+    for (auto& [landId, level] : levels) {
+        body.read(landId);
+        body.read(level);
+    }
+    return body.ok() && body.remaining() == 0;
+}
+
+
+} // namespace land::internal
@@ -0,0 +1,65 @@
+#pragma once
+#include "pland/Global.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace land::internal {
+
+class LandDimensionChunkMap;
+
+
+/**
+ * @brief 领地索引持久化
+ * 正常关闭时将区块映射与嵌套层级缓存写入二进制快照，下次启动时若领地数据指纹一致则直接恢复，跳过重建。
+ * 快照读取后即删除，异常退出不会留下可能过期的快照。
+ */
+class LandIndexPersistence final {
+public:
+    inline static constexpr std::string_view FileName      = "land_index.bin"; // 快照文件名(位于数据目录，与 db 同级)
+    inline static constexpr uint32_t         Magic         = 0x58494C50;       // "PLIX"
+    inline static constexpr uint32_t         FormatVersion = 3;                // 快照格式版本
+
+    using LevelTable = std::vector<std::pair<LandID, int>>; // 领地ID --> 嵌套层级
+
+    /**
+     * @brief 领地数据指纹
+     * 按数据库迭代顺序累积每条领地数据的键与值，任意领地增删改都会改变指纹
+     */
+    class Fingerprint {
+        uint64_t mHash{0xCBF29CE484222325ull};
+        uint64_t mCount{0};
+
+    public:
+        void update(std::string_view key, std::string_view value);
+
+        [[nodiscard]] uint64_t value() const;
+    };
+
+    LandIndexPersistence() = delete;
+
+    /**
+     * @brief 写入快照
+     * @note 先写入临时文件再替换，避免写入中断留下残缺文件
+     */
+    static bool save(
+        std::filesystem::path const& file,
+        uint64_t                     fingerprint,
+        LandDimensionChunkMap const& map,
+        LevelTable const&            levels
+    );
+
+    /**
+     * @brief 读取并校验快照
+     * @param map 空索引，选项需与写入时一致
+     * @return 快照不存在、已损坏或与领地数据不匹配时返回 false
+     */
+    static bool
+    load(std::filesystem::path const& file, uint64_t fingerprint, LandDimensionChunkMap& map, LevelTable& levels);
+};
+
+
+} // namespace land::internal
@@ -0,0 +1,33 @@
+#pragma once
+#include "CowShardedMap.h"
+#include "LandDimensionChunkMap.h"
+
+#include "pland/Global.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace land {
+class Land;
+}
+
+namespace land::internal {
+
+
+/**
+ * @brief 领地索引快照
+ * 快照一经发布即不可变，读者通过原子指针获取后无需加锁即可查询；
+ * 写者(持有 Registry 写锁)复制当前快照并修改，随后整体替换 (Copy-On-Write)。
+ * 缓存表与区块映射均按分片共享结构，复制快照只复制分片指针，单次修改仅复制其触及的分片与分区。
+ * @note 快照仅保证索引结构(缓存表/区块映射)的一致性，Land 对象本身仍为共享的可变对象
+ */
+struct LandIndexSnapshot {
+    using LandCache = CowShardedMap<LandID, std::shared_ptr<Land>>;
+
+    LandCache             mLandCache;         // 领地缓存
+    LandDimensionChunkMap mDimensionChunkMap; // 维度区块映射
+    uint64_t              mGeneration{0};     // 快照代数(每次发布递增)
+};
+
+
+} // namespace land::internal
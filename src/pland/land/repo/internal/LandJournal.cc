@@ -0,0 +1,288 @@
+#include "LandJournal.h"
+#include "BinaryStream.h"
+
+#include "ll/api/io/FileUtils.h"
+#include "ll/api/io/Logger.h"
+
+#include <system_error>
+#include <utility>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace land::internal {
+
+namespace {
+
+constexpr size_t HeaderSize = sizeof(uint32_t) * 2; // 魔数 + 格式版本
+constexpr size_t FrameSize  = sizeof(uint32_t) * 2; // 记录长度 + 校验和
+
+uint32_t checksum(std::string_view bytes) {
+    uint32_t hash = 0x811C9DC5u;
+    for (auto c : bytes) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 0x01000193u;
+    }
+    return hash;
+}
+
+bool syncFile(std::FILE* file) {
+    if (std::fflush(file) != 0) {
+        return false;
+    }
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+} // namespace
+
+LandJournal::LandJournal(std::filesystem::path file, std::chrono::milliseconds interval, ll::io::Logger& logger)
+: mFile(std::move(file)),
+  mInterval(interval),
+  mLogger(logger) {
+    {
+        std::lock_guard guard(mFileMutex);
+        _open({});
+    }
+    mThread = std::thread([this] { _run(); });
+}
+
+LandJournal::~LandJournal() {
+    {
+        std::lock_guard guard(mMutex);
+        mStopping = true;
+    }
+    mWakeup.notify_all();
+    if (mThread.joinable()) {
+        mThread.join();
+    }
+
+    std::lock_guard guard(mFileMutex);
+    _flushPending();
+    if (mHandle) {
+        std::fclose(mHandle);
+        mHandle = nullptr;
+    }
+}
+
+void LandJournal::append(Op op, LandID landId, std::string_view value) {
+    std::string payload;
+    {
+        BinaryWriter writer{payload};
+        writer.write(static_cast<uint8_t>(op));
+        writer.write(landId);
+        writer.write(value);
+    }
+
+    std::string  frame;
+    BinaryWriter writer{frame};
+    writer.write(static_cast<uint32_t>(payload.size()));
+    writer.write(checksum(payload));
+    frame.append(payload);
+
+    bool wakeup;
+    {
+        std::lock_guard guard(mMutex);
+        wakeup    = mPending.empty();
+        mPending += frame;
+        mEnd     += frame.size();
+    }
+    if (wakeup) {
+        mWakeup.notify_one();
+    }
+}
+
+LandJournal::Mark LandJournal::mark() const {
+    std::lock_guard guard(mMutex);
+    return mEnd;
+}
+
+void LandJournal::checkpoint(Mark mark) {
+    std::lock_guard guard(mFileMutex);
+    _flushPending(); // 保证文件覆盖到 mark
+
+    if (mark <= mBase) {
+        return;
+    }
+    if (mark > mFlushed) {
+        // 写入失败而滞留在缓冲区的记录已被保存覆盖，直接丢弃
+        std::lock_guard pendingGuard(mMutex);
+        mPending.erase(0, static_cast<size_t>(mark - mFlushed));
+        mFlushed = mark;
+    }
+    if (mark == mFlushed) {
+        _open({});
+        mBase = mFlushed;
+        return;
+    }
+
+    // 保留 mark 之后的记录
+    auto data = ll::file_utils::readFile(mFile, true);
+    auto skip = HeaderSize + static_cast<size_t>(mark - mBase);
+    if (!data || data->size() < skip) {
+        _open({});
+        mBase = mFlushed;
+        return;
+    }
+    _open(std::string_view{*data}.substr(skip));
+    mBase = mark;
+}
+
+void LandJournal::_run() {
+    while (true) {
+        {
+            std::unique_lock lock(mMutex);
+            mWakeup.wait(lock, [this] { return mStopping || !mPending.empty(); });
+            if (mStopping) {
+                return; // 剩余记录由析构函数写入
+            }
+            // 等待一个提交间隔，将期间追加的记录合并为一次写入
+            mWakeup.wait_for(lock, mInterval, [this] { return mStopping; });
+        }
+        std::lock_guard guard(mFileMutex);
+        _flushPending();
+    }
+}
+
+void LandJournal::_flushPending() {
+    std::string bytes;
+    Mark        end;
+    {
+        std::lock_guard guard(mMutex);
+        bytes.swap(mPending);
+        end = mEnd;
+    }
+    if (bytes.empty()) {
+        return;
+    }
+    if (!_writeAndSync(bytes)) {
+        if (!mFailing) {
+            mLogger.error("领地变更日志写入失败，记录保留在内存中，将在下次提交时重试");
+            mFailing = true;
+        }
+        if (!_truncate()) {
+            // 无法回退文件时只能重建日志；已写入的记录丢失，其变更仍会由下次保存写入数据库
+            _open({});
+            mBase = mFlushed;
+        }
+        // 放回缓冲区头部，保持记录顺序；逻辑位置不变
+        std::lock_guard guard(mMutex);
+        mPending.insert(0, bytes);
+        return;
+    }
+    if (mFailing) {
+        mLogger.info("领地变更日志已恢复写入");
+        mFailing = false;
+    }
+    mFlushed = end;
+}
+
+bool LandJournal::_truncate() {
+    if (mHandle) {
+        std::fclose(mHandle);
+        mHandle = nullptr;
+    }
+    std::error_code ec;
+    std::filesystem::resize_file(mFile, HeaderSize + static_cast<uintmax_t>(mFlushed - mBase), ec);
+    if (ec) {
+        return false;
+    }
+    mHandle = std::fopen(mFile.string().c_str(), "ab");
+    return mHandle != nullptr;
+}
+
+bool LandJournal::_writeAndSync(std::string_view bytes) {
+    if (!mHandle) {
+        return false;
+    }
+    if (std::fwrite(bytes.data(), 1, bytes.size(), mHandle) != bytes.size()) {
+        return false;
+    }
+    return syncFile(mHandle);
+}
+
+bool LandJournal::_open(std::string_view body) {
+    if (mHandle) {
+        std::fclose(mHandle);
+        mHandle = nullptr;
+    }
+
+    std::string  content;
+    BinaryWriter writer{content};
+    writer.write(Magic);
+    writer.write(FormatVersion);
+    content.append(body);
+
+    // 先写入临时文件再替换，避免截断中断丢失尚未保存的记录
+    auto temp = mFile;
+    temp += ".tmp";
+    if (!ll::file_utils::writeFile(temp, content, true)) {
+        return false;
+    }
+    std::error_code ec;
+    std::filesystem::rename(temp, mFile, ec);
+    if (ec) {
+        return false;
+    }
+    mHandle = std::fopen(mFile.string().c_str(), "ab");
+    return mHandle != nullptr;
+}
+
+size_t LandJournal::replay(std::filesystem::path const& file, std::function<void(Record const&)> const& visitor) {
+    std::error_code ec;
+    if (!std::filesystem::exists(file, ec)) {
+        return 0;
+    }
+    auto data = ll::file_utils::readFile(file, true);
+    if (!data) {
+        return 0;
+    }
+
+    BinaryReader reader{*data};
+
+    uint32_t magic{0};
+    uint32_t version{0};
+    reader.read(magic);
+    reader.read(version);
+    if (!reader.ok() || magic != Magic || version != FormatVersion) {
+        return 0;
+    }
+
+    size_t count = 0;
+    while (reader.remaining() >= FrameSize) {
+        uint32_t size{0};
+        uint32_t sum{0};
+        reader.read(size);
+        reader.read(sum);
+        if (reader.remaining() < size) {
+            break; // 写入中断
+        }
+        auto payload = std::string_view{*data}.substr(data->size() - reader.remaining(), size);
+        if (checksum(payload) != sum) {
+            break;
+        }
+        reader.skip(size);
+
+        BinaryReader body{payload};
+        uint8_t      op{0};
+        Record       record{};
+        body.read(op);
+        body.read(record.mLandId);
+        body.read(record.mValue);
+        if (!body.ok() || body.remaining() != 0) {
+            break;
+        }
+        record.mOp = static_cast<Op>(op);
+        visitor(record);
+        ++count;
+    }
+    return count;
+}
+
+
+} // namespace land::internal
@@ -0,0 +1,114 @@
+#pragma once
+#include "pland/Global.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace ll::io {
+class Logger;
+}
+
+namespace land::internal {
+
+
+/**
+ * @brief 领地变更日志(预写日志)
+ * 领地变更以紧凑记录追加到内存缓冲，由后台线程按固定间隔批量写入文件并同步一次磁盘。
+ * 完整保存成功后截断已被保存覆盖的记录；异常退出后，启动时先将日志重放到数据库再加载领地。
+ * 所有记录均为幂等操作，重复重放不会产生副作用。
+ * 写入失败时记录保留在缓冲区，文件回退到上次成功写入的位置，下个提交周期重试。
+ */
+class LandJournal {
+public:
+    inline static constexpr std::string_view FileName      = "land_journal.bin"; // 日志文件名(位于数据目录，与 db 同级)
+    inline static constexpr uint32_t         Magic         = 0x4A4C4C50;         // "PLLJ"
+    inline static constexpr uint32_t         FormatVersion = 1;                  // 日志格式版本
+
+    enum class Op : uint8_t {
+        Upsert       = 1, // 写入完整领地数据(JSON)
+        Remove       = 2, // 删除领地
+        SetOwner     = 3, // 修改主人(UUID 字符串)
+        AddMember    = 4, // 添加成员(UUID 字符串)
+        RemoveMember = 5, // 移除成员(UUID 字符串)
+        SetName      = 6, // 修改名称
+        Patch        = 7, // 修改部分字段(LandContextCodec 按字段分组编码，合并到已有数据)
+    };
+
+    struct Record {
+        Op               mOp;
+        LandID           mLandId;
+        std::string_view mValue;
+    };
+
+    using Mark = uint64_t; // 日志逻辑位置
+
+    /**
+     * @brief 创建新的日志文件(已有文件将被清空)并启动提交线程
+     * @param interval 批量提交间隔
+     */
+    LandJournal(std::filesystem::path file, std::chrono::milliseconds interval, ll::io::Logger& logger);
+
+    /**
+     * @brief 提交剩余记录并停止提交线程
+     */
+    ~LandJournal();
+
+    LandJournal(LandJournal const&)            = delete;
+    LandJournal& operator=(LandJournal const&) = delete;
+
+    void append(Op op, LandID landId, std::string_view value = {});
+
+    /**
+     * @brief 获取当前日志末尾位置
+     * @note 在复制待保存数据前调用，保存成功后以此位置调用 checkpoint()
+     */
+    [[nodiscard]] Mark mark() const;
+
+    /**
+     * @brief 丢弃 mark 之前的记录
+     */
+    void checkpoint(Mark mark);
+
+    /**
+     * @brief 读取日志中的有效记录
+     * 遇到不完整或校验失败的记录(写入中断)时停止
+     * @return 读取的记录数量
+     */
+    static size_t replay(std::filesystem::path const& file, std::function<void(Record const&)> const& visitor);
+
+private:
+    void _run();
+    void _flushPending();                       // 将缓冲区写入文件，调用方需持有 mFileMutex
+    bool _writeAndSync(std::string_view bytes); // 调用方需持有 mFileMutex
+    bool _truncate();                           // 截断到已写入位置，丢弃残缺记录，调用方需持有 mFileMutex
+    bool _open(std::string_view body);          // 重新创建日志文件，调用方需持有 mFileMutex
+
+    std::filesystem::path     mFile;     // 日志文件路径
+    std::chrono::milliseconds mInterval; // 批量提交间隔
+    ll::io::Logger&           mLogger;   // 写入失败时输出日志
+
+    mutable std::mutex      mMutex;           // 缓冲区锁
+    std::condition_variable mWakeup;          // 提交线程唤醒
+    std::string             mPending;         // 尚未写入文件的记录
+    Mark                    mEnd{0};          // 日志末尾逻辑位置(含缓冲区)
+    bool                    mStopping{false}; // 停止标志
+
+    std::mutex mFileMutex;       // 文件锁
+    std::FILE* mHandle{nullptr}; // 日志文件
+    Mark       mBase{0};         // 文件中首条记录的逻辑位置
+    Mark       mFlushed{0};      // 已写入文件的逻辑位置
+    bool       mFailing{false};  // 上次写入是否失败(仅在状态变化时输出日志)
+
+    std::thread mThread; // 提交线程
+};
+
+
+} // namespace land::internal
@@ -0,0 +1,164 @@
+#include "LandNameIndex.h"
+
+#include <algorithm>
+
+namespace land::internal {
+
+std::string LandNameIndex::_normalize(std::string_view text) {
+    std::string result{text};
+    for (auto& c : result) {
+        if (c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+    }
+    return result;
+}
+
+std::vector<LandNameIndex::Trigram> LandNameIndex::_trigrams(std::string_view text) {
+    std::vector<Trigram> result;
+    if (text.size() < 3) {
+        return result;
+    }
+    result.reserve(text.size() - 2);
+    for (size_t i = 0; i + 3 <= text.size(); ++i) {
+        result.push_back(
+            static_cast<Trigram>(static_cast<uint8_t>(text[i])) << 16
+            | static_cast<Trigram>(static_cast<uint8_t>(text[i + 1])) << 8 | static_cast<uint8_t>(text[i + 2])
+        );
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+void LandNameIndex::add(LandID landId, std::string_view name) {
+    remove(landId);
+
+    auto& stored = mNames[landId];
+    stored       = _normalize(name);
+    for (auto trigram : _trigrams(stored)) {
+        mPostings[trigram].insert(landId);
+    }
+}
+
+void LandNameIndex::remove(LandID landId) {
+    auto iter = mNames.find(landId);
+    if (iter == mNames.end()) {
+        return;
+    }
+    for (auto trigram : _trigrams(iter->second)) {
+        auto posting = mPostings.find(trigram);
+        if (posting == mPostings.end()) {
+            continue;
+        }
+        posting->second.erase(landId);
+        if (posting->second.empty()) {
+            mPostings.erase(posting);
+        }
+    }
+    mNames.erase(iter);
+}
+
+void LandNameIndex::update(LandID landId, std::string_view name) {
+    auto iter = mNames.find(landId);
+    if (iter != mNames.end() && iter->second == _normalize(name)) {
+        return;
+    }
+    add(landId, name);
+}
+
+void LandNameIndex::clear() {
+    mNames.clear();
+    mPostings.clear();
+}
+
+void LandNameIndex::_match(
+    std::vector<Rank>& matches,
+    LandID             landId,
+    std::string const& name,
+    std::string const& needle,
+    Filter const&      filter
+) {
+    auto pos = name.find(needle);
+    if (pos == std::string::npos || (filter && !filter(landId))) {
+        return;
+    }
+    int kind = name.size() == needle.size() ? 0 : (pos == 0 ? 1 : 2);
+    matches.emplace_back(kind, pos, name.size(), landId);
+}
+
+LandNameIndex::SearchResult LandNameIndex::_page(std::vector<Rank>& matches, size_t offset, size_t limit) {
+    SearchResult result;
+    result.mTotal = matches.size();
+    if (offset >= matches.size()) {
+        return result;
+    }
+    // Rank 按字典序即为相关度排序，只需排出当前页及其之前的部分
+    auto const last = offset + std::min(limit, matches.size() - offset);
+    std::partial_sort(matches.begin(), matches.begin() + static_cast<ptrdiff_t>(last), matches.end());
+
+    result.mIds.reserve(last - offset);
+    for (auto i = offset; i < last; ++i) {
+        result.mIds.push_back(std::get<3>(matches[i]));
+    }
+    return result;
+}
+
+LandNameIndex::SearchResult
+LandNameIndex::search(std::string_view keyword, size_t offset, size_t limit, Filter const& filter) const {
+    auto const needle = _normalize(keyword);
+    if (needle.empty()) {
+        return {};
+    }
+
+    std::vector<Rank> matches;
+
+    auto check = [&](LandID landId, std::string const& name) { _match(matches, landId, name, needle, filter); };
+
+    auto const trigrams = _trigrams(needle);
+    if (trigrams.empty()) {
+        for (auto const& [landId, name] : mNames) {
+            check(landId, name);
+        }
+    } else {
+        // 取最短的倒排表作为候选集
+        absl::flat_hash_set<LandID> const* candidates = nullptr;
+        for (auto trigram : trigrams) {
+            auto iter = mPostings.find(trigram);
+            if (iter == mPostings.end()) {
+                return {}; // 任一三元组不存在，必然无匹配
+            }
+            if (!candidates || iter->second.size() < candidates->size()) {
+                candidates = &iter->second;
+            }
+        }
+        for (auto landId : *candidates) {
+            check(landId, mNames.at(landId));
+        }
+    }
+    return _page(matches, offset, limit);
+}
+
+LandNameIndex::SearchResult LandNameIndex::searchIn(
+    std::vector<LandID> const& scope,
+    std::string_view           keyword,
+    size_t                     offset,
+    size_t                     limit,
+    Filter const&              filter
+) const {
+    auto const needle = _normalize(keyword);
+    if (needle.empty()) {
+        return {};
+    }
+
+    std::vector<Rank> matches;
+    for (auto landId : scope) {
+        auto iter = mNames.find(landId);
+        if (iter != mNames.end()) {
+            _match(matches, landId, iter->second, needle, filter);
+        }
+    }
+    return _page(matches, offset, limit);
+}
+
+} // namespace land::internal
@@ -0,0 +1,88 @@
+#pragma once
+#include "pland/Global.h"
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace land::internal {
+
+
+/**
+ * @brief 领地名称三元组倒排索引
+ * 名称统一转为小写(仅 ASCII)后按字节切分为三元组，UTF-8 多字节字符同样适用。
+ * 查询时取关键字中候选最少的三元组倒排表，再逐个校验子串；不足 3 字节的关键字回退为扫描名称表。
+ * @note 非线程安全，由 LandRegistry 加锁保护
+ */
+class LandNameIndex {
+public:
+    struct SearchResult {
+        std::vector<LandID> mIds;      // 当前页的领地ID(按相关度排序)
+        size_t              mTotal{0}; // 匹配总数
+    };
+
+    using Filter = std::function<bool(LandID)>; // 额外过滤条件，返回 false 的领地不计入结果
+
+    void add(LandID landId, std::string_view name);
+
+    void remove(LandID landId);
+
+    /**
+     * @brief 更新领地名称(名称未变化时不做任何事)
+     */
+    void update(LandID landId, std::string_view name);
+
+    void clear();
+
+    /**
+     * @brief 按关键字搜索领地
+     * 排序规则: 完全匹配 > 前缀匹配 > 子串匹配，其次匹配位置靠前、名称较短、ID 较小者优先
+     * @param offset 跳过的结果数量
+     * @param limit 返回的最大结果数量
+     */
+    [[nodiscard]] SearchResult
+    search(std::string_view keyword, size_t offset, size_t limit, Filter const& filter = {}) const;
+
+    /**
+     * @brief 仅在给定领地范围内搜索
+     * 逐个校验范围内领地的名称，不访问倒排表，适用于玩家自己的领地等小范围；排序规则同 search
+     */
+    [[nodiscard]] SearchResult searchIn(
+        std::vector<LandID> const& scope,
+        std::string_view           keyword,
+        size_t                     offset,
+        size_t                     limit,
+        Filter const&              filter = {}
+    ) const;
+
+private:
+    using Trigram = uint32_t;
+    using Rank    = std::tuple<int, size_t, size_t, LandID>; // (匹配类型, 匹配位置, 名称长度, 领地ID)
+
+    [[nodiscard]] static std::string          _normalize(std::string_view text);
+    [[nodiscard]] static std::vector<Trigram> _trigrams(std::string_view text);
+
+    // 名称包含关键字且通过过滤时记录排序键；先匹配再过滤，过滤条件只对命中的领地求值
+    static void _match(
+        std::vector<Rank>& matches,
+        LandID             landId,
+        std::string const& name,
+        std::string const& needle,
+        Filter const&      filter
+    );
+
+    [[nodiscard]] static SearchResult _page(std::vector<Rank>& matches, size_t offset, size_t limit);
+
+    absl::flat_hash_map<LandID, std::string>                  mNames;    // 领地 --> 小写名称
+    absl::flat_hash_map<Trigram, absl::flat_hash_set<LandID>> mPostings; // 三元组 --> 领地
+};
+
+
+} // namespace land::internal
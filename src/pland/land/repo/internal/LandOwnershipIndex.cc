@@ -0,0 +1,102 @@
+#include "LandOwnershipIndex.h"
+
+#include "pland/land/Land.h"
+
+namespace land::internal {
+
+namespace {
+
+template <typename Map, typename Key>
+void eraseLand(Map& map, Key const& key, LandID landId) {
+    auto iter = map.find(key);
+    if (iter == map.end()) {
+        return;
+    }
+    iter->second.erase(landId);
+    if (iter->second.empty()) {
+        map.erase(iter);
+    }
+}
+
+} // namespace
+
+void LandOwnershipIndex::_link(LandID landId, Entry const& entry) {
+    mOwned[entry.mOwner].insert(landId);
+    for (auto const& member : entry.mMembers) {
+        mShared[member].insert(landId);
+    }
+    mDimensions[entry.mDimId].insert(landId);
+}
+
+void LandOwnershipIndex::_unlink(LandID landId, Entry const& entry) {
+    eraseLand(mOwned, entry.mOwner, landId);
+    for (auto const& member : entry.mMembers) {
+        eraseLand(mShared, member, landId);
+    }
+    eraseLand(mDimensions, entry.mDimId, landId);
+}
+
+void LandOwnershipIndex::add(Land const& land) {
+    auto landId = land.getId();
+    if (auto iter = mEntries.find(landId); iter != mEntries.end()) {
+        _unlink(landId, iter->second);
+    }
+
+    auto& entry  = mEntries[landId];
+    entry.mLand  = &land;
+    entry.mOwner = land.getOwner();
+    entry.mMembers.assign(land.getMembers().begin(), land.getMembers().end());
+    entry.mDimId = land.getDimensionId();
+    _link(landId, entry);
+}
+
+void LandOwnershipIndex::remove(LandID landId) {
+    auto iter = mEntries.find(landId);
+    if (iter == mEntries.end()) {
+        return;
+    }
+    _unlink(landId, iter->second);
+    mEntries.erase(iter);
+}
+
+bool LandOwnershipIndex::sync(Land const& land) {
+    if (!contains(land)) {
+        return false;
+    }
+    add(land);
+    return true;
+}
+
+bool LandOwnershipIndex::contains(Land const& land) const {
+    auto iter = mEntries.find(land.getId());
+    return iter != mEntries.end() && iter->second.mLand == &land;
+}
+
+void LandOwnershipIndex::clear() {
+    mEntries.clear();
+    mOwned.clear();
+    mShared.clear();
+    mDimensions.clear();
+}
+
+LandOwnershipIndex::LandSet const* LandOwnershipIndex::findOwned(mce::UUID const& uuid) const {
+    auto iter = mOwned.find(uuid);
+    return iter == mOwned.end() ? nullptr : &iter->second;
+}
+
+LandOwnershipIndex::LandSet const* LandOwnershipIndex::findShared(mce::UUID const& uuid) const {
+    auto iter = mShared.find(uuid);
+    return iter == mShared.end() ? nullptr : &iter->second;
+}
+
+LandOwnershipIndex::LandSet const* LandOwnershipIndex::findInDimension(LandDimid dimId) const {
+    auto iter = mDimensions.find(dimId);
+    return iter == mDimensions.end() ? nullptr : &iter->second;
+}
+
+std::unordered_map<mce::UUID, LandOwnershipIndex::LandSet> const& LandOwnershipIndex::getOwnedMap() const {
+    return mOwned;
+}
+
+
+} // namespace land::internal
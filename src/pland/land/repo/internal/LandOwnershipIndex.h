@@ -0,0 +1,80 @@
+#pragma once
+#include "pland/Global.h"
+
+#include "mc/platform/UUID.h"
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace land {
+class Land;
+}
+
+namespace land::internal {
+
+
+/**
+ * @brief 领地归属二级索引
+ * 主人 --> [领地]、成员 --> [领地]、维度 --> [领地]，按玩家/维度查询的耗时与结果数量成正比。
+ * 每个领地额外记录登记时的主人与成员，领地数据变更后据此从旧集合中移除。
+ * @note 非线程安全，由 LandRegistry 加锁保护
+ */
+class LandOwnershipIndex {
+public:
+    using LandSet = absl::flat_hash_set<LandID>;
+
+    /**
+     * @brief 登记领地
+     */
+    void add(Land const& land);
+
+    /**
+     * @brief 移除领地
+     */
+    void remove(LandID landId);
+
+    /**
+     * @brief 按领地当前的主人与成员重新登记
+     * @note 仅同步已登记的同一领地对象，未登记(或 ID 相同的其它对象)将被忽略
+     * @return 领地是否已登记
+     */
+    bool sync(Land const& land);
+
+    void clear();
+
+    /**
+     * @brief 领地对象是否已登记
+     */
+    [[nodiscard]] bool contains(Land const& land) const;
+
+    [[nodiscard]] LandSet const* findOwned(mce::UUID const& uuid) const;
+
+    [[nodiscard]] LandSet const* findShared(mce::UUID const& uuid) const;
+
+    [[nodiscard]] LandSet const* findInDimension(LandDimid dimId) const;
+
+    [[nodiscard]] std::unordered_map<mce::UUID, LandSet> const& getOwnedMap() const;
+
+private:
+    struct Entry {
+        Land const*            mLand{nullptr}; // 登记的领地对象
+        mce::UUID              mOwner;         // 登记时的主人
+        std::vector<mce::UUID> mMembers;       // 登记时的成员
+        LandDimid              mDimId{0};      // 维度
+    };
+
+    void _link(LandID landId, Entry const& entry);
+    void _unlink(LandID landId, Entry const& entry);
+
+    absl::flat_hash_map<LandID, Entry>      mEntries;    // 领地 --> 登记记录
+    std::unordered_map<mce::UUID, LandSet>  mOwned;      // 主人 --> 领地
+    std::unordered_map<mce::UUID, LandSet>  mShared;     // 成员 --> 领地
+    absl::flat_hash_map<LandDimid, LandSet> mDimensions; // 维度 --> 领地
+};
+
+
+} // namespace land::internal
@@ -0,0 +1,90 @@
+#include "LandPointQuery.h"
+#include "LandIndexSnapshot.h"
+
+#include "pland/land/Land.h"
+
+namespace land::internal {
+
+
+LandPointQuery::BucketHit LandPointQuery::_firstHitInBucket(
+    LandIndexSnapshot const&                  index,
+    LandDimensionChunkMap::ChunkBucket const& bucket,
+    BlockPos const&                           pos
+) {
+    int const localX = pos.x & 15;
+    int const localZ = pos.z & 15;
+
+    // 2D 领地仅凭列掩码即可判定；整区块被单个领地覆盖时首个条目即命中
+    for (auto const& entry : bucket) {
+        if (!entry.hasColumn(localX, localZ)) {
+            continue; // 列未被覆盖
+        }
+        auto land = index.mLandCache.find(entry.mLandId);
+        if (!land) {
+            continue;
+        }
+        if (entry.mIs3D && !(*land)->getAABB().hasPos(pos, true)) {
+            continue;
+        }
+        return {&entry, land};
+    }
+    return {};
+}
+
+LandPointQuery::ChunkContext
+LandPointQuery::prepareChunk(LandIndexSnapshot const& index, LandDimid dimid, int chunkX, int chunkZ) {
+    auto const& map = index.mDimensionChunkMap;
+
+    ChunkContext ctx{chunkX, chunkZ};
+    map.forEachLargeLand(dimid, chunkX, chunkX, chunkZ, chunkZ, [&](auto const& entry) {
+        ctx.mLarge.push_back(&entry);
+    });
+    // 荒野快速路径: 位图未置位时区块桶与高度段必然为空，跳过哈希查询
+    ctx.mMarked = map.isChunkMarked(dimid, chunkX, chunkZ);
+    if (ctx.mMarked) {
+        ctx.mColumn = map.queryLand(dimid, chunkX, chunkZ);
+    }
+    return ctx;
+}
+
+std::shared_ptr<Land> const* LandPointQuery::queryInChunk(
+    LandIndexSnapshot const& index,
+    ChunkContext const&      ctx,
+    BlockPos const&          pos,
+    LandDimid                dimid
+) {
+    BucketHit best{};
+    if (ctx.mMarked) {
+        if (ctx.mColumn) {
+            best = _firstHitInBucket(index, *ctx.mColumn, pos);
+        }
+        // 分段的3D领地与列结构各自有序，按层级合并两者的首个命中(子领地优先级最高)
+        if (auto bucket = index.mDimensionChunkMap.querySection(dimid, ctx.mChunkX, ctx.mChunkZ, pos.y >> 4)) {
+            auto hit = _firstHitInBucket(index, *bucket, pos);
+            if (hit.mLand && (!best.mLand || hit.mEntry->mLevel > best.mEntry->mLevel)) {
+                best = hit;
+            }
+        }
+    }
+
+    // 大型领地未按层级排序，需检查全部候选
+    int bestLevel = best.mLand ? best.mEntry->mLevel : -1;
+    for (auto entry : ctx.mLarge) {
+        if (entry->mLevel <= bestLevel || !entry->mAABB.hasPos(pos, entry->mIs3D)) {
+            continue;
+        }
+        if (auto land = index.mLandCache.find(entry->mLandId)) {
+            bestLevel = entry->mLevel;
+            best      = {nullptr, land};
+        }
+    }
+    return best.mLand;
+}
+
+std::shared_ptr<Land> const*
+LandPointQuery::queryAt(LandIndexSnapshot const& index, BlockPos const& pos, LandDimid dimid) {
+    return queryInChunk(index, prepareChunk(index, dimid, pos.x >> 4, pos.z >> 4), pos, dimid);
+}
+
+
+} // namespace land::internal
@@ -0,0 +1,77 @@
+#pragma once
+#include "LandDimensionChunkMap.h"
+
+#include "pland/Global.h"
+
+#include "mc/world/level/BlockPos.h"
+
+#include "absl/container/inlined_vector.h"
+
+#include <memory>
+
+namespace land {
+class Land;
+}
+
+namespace land::internal {
+
+struct LandIndexSnapshot;
+
+
+/**
+ * @brief 领地坐标点查询
+ * 在快照的区块桶中借助列覆盖掩码与嵌套层级排序定位坐标所在的最深层领地
+ */
+class LandPointQuery final {
+public:
+    /**
+     * @brief 单个区块的查询上下文(同一区块内的多次点查询可复用)
+     */
+    struct ChunkContext {
+        using LargeCandidates = absl::InlinedVector<LandDimensionChunkMap::LargeLandEntry const*, 4>;
+
+        int                                       mChunkX{0};       // 区块 X
+        int                                       mChunkZ{0};       // 区块 Z
+        bool                                      mMarked{false};   // 区块占用位图是否置位
+        LandDimensionChunkMap::ChunkBucket const* mColumn{nullptr}; // 列结构区块桶
+        LargeCandidates                           mLarge;           // 大型领地候选
+    };
+
+    LandPointQuery() = delete;
+
+    [[nodiscard]] static ChunkContext
+    prepareChunk(LandIndexSnapshot const& index, LandDimid dimid, int chunkX, int chunkZ);
+
+    /**
+     * @brief 在区块上下文中查询坐标所在的领地
+     * @return 指向快照内 shared_ptr 的指针，生命周期与快照一致
+     */
+    [[nodiscard]] static std::shared_ptr<Land> const*
+    queryInChunk(LandIndexSnapshot const& index, ChunkContext const& ctx, BlockPos const& pos, LandDimid dimid);
+
+    /**
+     * @brief 查询坐标所在的领地
+     * @return 指向快照内 shared_ptr 的指针，生命周期与快照一致
+     */
+    [[nodiscard]] static std::shared_ptr<Land> const*
+    queryAt(LandIndexSnapshot const& index, BlockPos const& pos, LandDimid dimid);
+
+private:
+    struct BucketHit {
+        LandDimensionChunkMap::ChunkEntry const* mEntry{nullptr};
+        std::shared_ptr<Land> const*             mLand{nullptr};
+    };
+
+    /**
+     * @brief 在区块桶中查找首个包含坐标的领地
+     * @note 区块桶按嵌套层级降序排列，首个命中即为该桶内最深层的领地
+     */
+    static BucketHit _firstHitInBucket(
+        LandIndexSnapshot const&                  index,
+        LandDimensionChunkMap::ChunkBucket const& bucket,
+        BlockPos const&                           pos
+    );
+};
+
+
+} // namespace land::internal
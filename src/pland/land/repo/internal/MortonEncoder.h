@@ -0,0 +1,102 @@
+#pragma once
+#include <cstdint>
+#include <utility>
+
+namespace land::internal {
+
+using MortonKey = uint64_t; // Morton(Z序) 区块键
+
+/**
+ * @brief Morton(Z序) 区块编码
+ * 将区块坐标的 X/Z 位交错编码，空间上相邻的区块在键空间上也尽量相邻，
+ * 矩形查询可转化为少量的有序区间扫描
+ * Memory layout:
+ * [... z1 x1 z0 x0] (x 占偶数位, z 占奇数位)
+ */
+struct MortonEncoder {
+    MortonEncoder() = delete;
+
+    inline static constexpr MortonKey MaskX = 0x5555555555555555ULL; // X 轴所在位
+    inline static constexpr MortonKey MaskZ = 0xAAAAAAAAAAAAAAAAULL; // Z 轴所在位
+
+    [[nodiscard]] inline static MortonKey encode(int x, int z) {
+        // 翻转符号位，使有符号坐标的顺序与无符号编码一致
+        auto ux = static_cast<uint32_t>(x) ^ 0x80000000u;
+        auto uz = static_cast<uint32_t>(z) ^ 0x80000000u;
+        return _spread(ux) | (_spread(uz) << 1);
+    }
+
+    [[nodiscard]] inline static std::pair<int, int> decode(MortonKey key) {
+        return {
+            static_cast<int>(_compact(key) ^ 0x80000000u),
+            static_cast<int>(_compact(key >> 1) ^ 0x80000000u),
+        };
+    }
+
+    /**
+     * @brief 判断键是否位于 [min, max] 构成的矩形内
+     * @note 同一轴的位在交错后保持相对顺序，因此可按轴掩码直接比较
+     */
+    [[nodiscard]] inline static bool inRange(MortonKey key, MortonKey min, MortonKey max) {
+        return (key & MaskX) >= (min & MaskX) && (key & MaskX) <= (max & MaskX) && (key & MaskZ) >= (min & MaskZ)
+            && (key & MaskZ) <= (max & MaskZ);
+    }
+
+    /**
+     * @brief BIGMIN: 计算矩形 [min, max] 内大于 key 的最小 Morton 键
+     * @see Tropf, H. & Herzog, H. (1981) Multidimensional Range Search in Dynamically Balanced Trees
+     */
+    [[nodiscard]] inline static MortonKey bigMin(MortonKey key, MortonKey min, MortonKey max) {
+        MortonKey result = 0;
+        for (int bit = 63; bit >= 0; --bit) {
+            MortonKey const mask    = 1ULL << bit;
+            MortonKey const dimMask = (bit & 1) ? MaskZ : MaskX;
+            MortonKey const span    = dimMask & ((mask << 1) - 1); // 当前轴中 bit 及以下的位
+
+            int const code = ((key & mask) ? 4 : 0) | ((min & mask) ? 2 : 0) | ((max & mask) ? 1 : 0);
+            switch (code) {
+            case 0b000:
+            case 0b111:
+                break;
+            case 0b001:
+                result = (min & ~span) | mask;                    // load 1000...
+                max    = (max & ~span) | (dimMask & (mask - 1)); // load 0111...
+                break;
+            case 0b011:
+                return min;
+            case 0b100:
+                return result;
+            case 0b101:
+                min = (min & ~span) | mask; // load 1000...
+                break;
+            default:
+                return result; // min > max，不可能出现
+            }
+        }
+        return result;
+    }
+
+private:
+    [[nodiscard]] inline static MortonKey _spread(uint32_t v) {
+        MortonKey x = v;
+        x           = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+        x           = (x | (x << 8)) & 0x00FF00FF00FF00FFULL;
+        x           = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        x           = (x | (x << 2)) & 0x3333333333333333ULL;
+        x           = (x | (x << 1)) & 0x5555555555555555ULL;
+        return x;
+    }
+
+    [[nodiscard]] inline static uint32_t _compact(MortonKey x) {
+        x &= 0x5555555555555555ULL;
+
+        x = (x | (x >> 1)) & 0x3333333333333333ULL;
+        x = (x | (x >> 2)) & 0x0F0F0F0F0F0F0F0FULL;
+        x = (x | (x >> 4)) & 0x00FF00FF00FF00FFULL;
+        x = (x | (x >> 8)) & 0x0000FFFF0000FFFFULL;
+        x = (x | (x >> 16)) & 0x00000000FFFFFFFFULL;
+        return static_cast<uint32_t>(x);
+    }
+};
+
+} // namespace land::internal
@@ -0,0 +1,86 @@
+#include "PlayerSettingsStore.h"
+
+namespace land::internal {
+
+PlayerSettingsStore::PlayerSettingsStore() {
+    for (auto& shard : mShards) {
+        _publish(shard, {});
+    }
+}
+
+size_t PlayerSettingsStore::shardOf(mce::UUID const& uuid) {
+    // 不使用 std::hash，分片归属需在不同版本间保持稳定
+    auto mixed  = uuid.a ^ uuid.b;
+    mixed      ^= mixed >> 32;
+    return static_cast<size_t>(mixed % ShardCount);
+}
+
+void PlayerSettingsStore::_publish(Shard& shard, Map map) {
+    shard.mMap.store(std::make_shared<Map const>(std::move(map)), std::memory_order_release);
+}
+
+PlayerSettings PlayerSettingsStore::get(mce::UUID const& uuid) const {
+    auto map  = mShards[shardOf(uuid)].mMap.load(std::memory_order_acquire);
+    auto iter = map->find(uuid);
+    return iter != map->end() ? iter->second : PlayerSettings{};
+}
+
+void PlayerSettingsStore::set(mce::UUID const& uuid, PlayerSettings const& settings) {
+    auto&           shard = mShards[shardOf(uuid)];
+    std::lock_guard guard(shard.mMutex);
+
+    auto map  = *shard.mMap.load(std::memory_order_relaxed); // 写者持有分片锁
+    map[uuid] = settings;
+    _publish(shard, std::move(map));
+    shard.mDirty = true;
+}
+
+void PlayerSettingsStore::load(Map const& data, bool dirty) {
+    std::array<Map, ShardCount> buckets;
+    for (auto const& [uuid, settings] : data) {
+        buckets[shardOf(uuid)].insert_or_assign(uuid, settings);
+    }
+    for (size_t i = 0; i < ShardCount; ++i) {
+        if (buckets[i].empty()) {
+            continue;
+        }
+        auto&           shard = mShards[i];
+        std::lock_guard guard(shard.mMutex);
+
+        auto map = *shard.mMap.load(std::memory_order_relaxed);
+        for (auto& [uuid, settings] : buckets[i]) {
+            map.insert_or_assign(uuid, settings);
+        }
+        _publish(shard, std::move(map));
+        shard.mDirty = shard.mDirty || dirty;
+    }
+}
+
+std::vector<std::pair<size_t, PlayerSettingsStore::MapPtr>> PlayerSettingsStore::takeDirty() {
+    std::vector<std::pair<size_t, MapPtr>> result;
+    for (size_t i = 0; i < ShardCount; ++i) {
+        auto&           shard = mShards[i];
+        std::lock_guard guard(shard.mMutex);
+        if (shard.mDirty) {
+            shard.mDirty = false;
+            result.emplace_back(i, shard.mMap.load(std::memory_order_relaxed));
+        }
+    }
+    return result;
+}
+
+void PlayerSettingsStore::markDirty(size_t shard) {
+    std::lock_guard guard(mShards[shard].mMutex);
+    mShards[shard].mDirty = true;
+}
+
+size_t PlayerSettingsStore::size() const {
+    size_t total = 0;
+    for (auto const& shard : mShards) {
+        total += shard.mMap.load(std::memory_order_acquire)->size();
+    }
+    return total;
+}
+
+
+} // namespace land::internal
@@ -0,0 +1,75 @@
+#pragma once
+#include "pland/land/repo/LandRegistry.h"
+
+#include "mc/platform/UUID.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace land::internal {
+
+
+/**
+ * @brief 玩家个人设置存储
+ * 按玩家 UUID 分片，每个分片持有一份不可变映射，写入时复制所在分片并整体替换；读取仅原子加载分片映射，不加锁。
+ * 每个分片对应数据库中的一个键，保存时只写回发生变化的分片。
+ * @note 读取方持有映射的引用计数，被替换的旧映射由最后一个持有者释放，任意线程均可读取
+ */
+class PlayerSettingsStore {
+public:
+    inline static constexpr size_t ShardCount = 16; // 分片数量(决定数据库键，不可随意修改)
+
+    using Map    = std::unordered_map<mce::UUID, PlayerSettings>;
+    using MapPtr = std::shared_ptr<Map const>;
+
+    PlayerSettingsStore();
+
+    /**
+     * @brief 获取玩家设置(无锁)
+     * @return 未设置过的玩家返回默认设置
+     */
+    [[nodiscard]] PlayerSettings get(mce::UUID const& uuid) const;
+
+    /**
+     * @brief 写入玩家设置并标记所在分片为脏
+     */
+    void set(mce::UUID const& uuid, PlayerSettings const& settings);
+
+    /**
+     * @brief 载入分片数据(启动时使用)
+     * @param dirty 是否标记为脏，用于数据迁移后写回
+     */
+    void load(Map const& data, bool dirty);
+
+    /**
+     * @brief 取出所有脏分片的当前映射并清除脏标记
+     * @note 写回失败的分片需调用 markDirty() 重新标记
+     */
+    [[nodiscard]] std::vector<std::pair<size_t, MapPtr>> takeDirty();
+
+    void markDirty(size_t shard);
+
+    [[nodiscard]] size_t size() const;
+
+    [[nodiscard]] static size_t shardOf(mce::UUID const& uuid);
+
+private:
+    struct Shard {
+        mutable std::mutex  mMutex;        // 写者互斥
+        std::atomic<MapPtr> mMap;          // 当前映射(无锁读取)
+        bool                mDirty{false}; // 是否需要写回
+    };
+
+    static void _publish(Shard& shard, Map map);
+
+    std::array<Shard, ShardCount> mShards;
+};
+
+
+} // namespace land::internal
@@ -78,7 +78,7 @@ ll::Expected<> LandCreateValidator::validateCreateSubLand(
 
 
 ll::Expected<> LandCreateValidator::isPlayerLandCountLimitExceeded(LandRegistry& registry, mce::UUID const& uuids) {
-    auto  count    = static_cast<int>(registry.getLands(uuids).size());
+    auto  count    = static_cast<int>(registry.getLandCount(uuids));
     auto& maxCount = Config::cfg.land.maxLand;
 
     // 非管理员 && 领地数量超过限制
@@ -154,27 +154,27 @@ ll::Expected<> LandCreateValidator::isOrdinaryLandRangeConflict(
     bool const  includeY   = Config::cfg.land.minSpacingIncludeY; // 获取配置
 
     auto expanded = aabb.expanded(minSpacing, includeY);
-    auto lands    = registry.getLandAt(expanded.min.as(), expanded.max.as(), land->getDimensionId());
-    if (lands.empty()) {
-        return {};
-    }
 
-    for (auto& ld : lands) {
+    ll::Expected<> result{};
+    registry.forEachLandIn(expanded, land->getDimensionId(), [&](std::shared_ptr<Land> const& ld) {
         if (newRange && ld == land) {
-            continue; // 仅在更改范围时排除自己
+            return true; // 仅在更改范围时排除自己
         }
 
         if (LandAABB::isCollision(ld->getAABB(), aabb)) {
             // 领地范围与其他领地冲突
-            return makeError<LandRangeConflictContext>(aabb, ld);
+            result = makeError<LandRangeConflictContext>(aabb, ld);
+            return false;
         }
         if (!LandAABB::isComplisWithMinSpacing(ld->getAABB(), aabb, minSpacing)) {
             // 领地范围与其他领地间距过小
             int actualDist = LandAABB::getMinSpacing(ld->getAABB(), aabb, includeY);
-            return makeError<LandSpacingContext>(actualDist, minSpacing, ld);
+            result         = makeError<LandSpacingContext>(actualDist, minSpacing, ld);
+            return false;
         }
-    }
-    return {};
+        return true;
+    });
+    return result;
 }
 
 ll::Expected<> LandCreateValidator::isSubLandPositionLegal(
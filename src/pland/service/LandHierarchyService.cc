@@ -39,6 +39,7 @@ LandHierarchyService::attachSubLand(std::shared_ptr<Land> const& parent, std::sh
     if (result) {
         // parent 可能位于任意层级，但parent下新建的 sub 领地，这个新领地没有子节点，直接进行 +1
         sub->_setCachedNestedLevel(parent->getNestedLevel() + 1);
+        impl->mLandRegistry.refreshLandLevels({sub});
     }
     return result;
 }
@@ -192,11 +193,15 @@ void LandHierarchyService::updateLevels(std::shared_ptr<Land> const& root, int r
     std::stack<std::pair<std::shared_ptr<Land>, int>> stack;
     stack.push({root, rootLevel});
 
+    std::vector<std::shared_ptr<Land>> changed;
     while (!stack.empty()) {
         auto [curr, level] = stack.top();
         stack.pop();
 
-        curr->_setCachedNestedLevel(level);
+        if (curr->getNestedLevel() != level) {
+            curr->_setCachedNestedLevel(level);
+            changed.push_back(curr);
+        }
 
         if (curr->hasSubLand()) {
             for (auto& child : getSubLands(curr)) {
@@ -204,6 +209,7 @@ void LandHierarchyService::updateLevels(std::shared_ptr<Land> const& root, int r
             }
         }
     }
+    impl->mLandRegistry.refreshLandLevels(changed); // 维持空间索引的层级排序
 }
 
 
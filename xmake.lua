@@ -35,6 +35,11 @@ option("devtool") -- 开发工具
     set_showmenu(true)
 option_end()
 
+option("test") -- 内置自检用例(插件加载时运行，失败时停止加载)与性能基准(命令 pland bench)
+    set_default(false)
+    set_showmenu(true)
+option_end()
+
 target("PLand")
     add_rules("@levibuildscript/linkrule")
     add_rules("@levibuildscript/modpacker")
@@ -91,6 +96,12 @@ target("PLand")
         add_defines("LD_DEVTOOL")
     end
 
+    if has_config("test") then
+        add_includedirs("src-test")
+        add_files("src-test/**.cc")
+        add_defines("LD_TEST")
+    end
+
     after_build(function (target)
         local bindir = path.join(os.projectdir(), "bin")
         local outputdir = path.join(bindir, target:name())